@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include <argument_spec.hxx>
+#include <struct.hxx>
+#include <typelists.hxx>
+
+namespace
+{
+    template <size_t Index>
+    struct option_t
+    {
+        int value{};
+    };
+
+    // Long enough not to fit in the small string buffer: building the default allocates.
+    struct name_t
+    {
+        std::string value{ "a name long enough to be allocated on the heap" };
+    };
+
+    template <size_t Index>
+    struct default_option
+    {
+        auto operator ()() const
+        {
+            return option_t<Index>{ static_cast<int>(Index) };
+        }
+    };
+
+    template <size_t ...Indices>
+    struct factories
+    {
+        using struct_type = pi::tl::struct_t<name_t, option_t<Indices>...>;
+        using spec = pi::tl::argument_spec<pi::tl::field<name_t, pi::tl::lazy{ [] { return name_t{}; } }>, pi::tl::field<option_t<Indices>, pi::tl::lazy{ default_option<Indices>{} }>...>;
+
+        // One lookup (and one default, built whether it is used or not) per field.
+        template <typename ...Arguments>
+        static auto get_or_initialize(Arguments &&...arguments)
+        {
+            auto result = struct_type{};
+            result.set(pi::tl::get_or_initialize(name_t{}, std::forward<Arguments>(arguments)...));
+            (result.set(pi::tl::get_or_initialize(option_t<Indices>{ static_cast<int>(Indices) }, std::forward<Arguments>(arguments)...)), ...);
+            return result;
+        }
+
+        template <typename ...Arguments>
+        static auto parse(Arguments &&...arguments)
+        {
+            return spec::parse(std::forward<Arguments>(arguments)...);
+        }
+    };
+
+    template <size_t ...Indices>
+    auto make_factories(std::index_sequence<Indices...>) -> factories<Indices...>;
+
+    // A factory function with 20 optional named arguments.
+    using factories_t = decltype(make_factories(std::make_index_sequence<20U>{}));
+}
+
+TEST_CASE("Factory with 20 optional named arguments: get_or_initialize per field, against argument_spec", "[benchmark]")
+{
+    auto value = 0;
+
+    BENCHMARK("get_or_initialize per field (3 arguments)")
+    {
+        auto result = factories_t::get_or_initialize(option_t<7U>{ ++value }, name_t{ "short" }, option_t<3U>{ value });
+        return result.get<option_t<7U>>().value + result.get<option_t<19U>>().value;
+    };
+
+    BENCHMARK("argument_spec parse (3 arguments)")
+    {
+        auto result = factories_t::parse(option_t<7U>{ ++value }, name_t{ "short" }, option_t<3U>{ value });
+        return result.get<option_t<7U>>().value + result.get<option_t<19U>>().value;
+    };
+
+    BENCHMARK("get_or_initialize per field (no arguments)")
+    {
+        auto result = factories_t::get_or_initialize();
+        return result.get<name_t>().value.size();
+    };
+
+    BENCHMARK("argument_spec parse (no arguments)")
+    {
+        auto result = factories_t::parse();
+        return result.get<name_t>().value.size();
+    };
+}
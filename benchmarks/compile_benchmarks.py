@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Measures the compile-time cost of the PiTypeLists API as the type lists grow.
+
+For every API and every list size, a translation unit that instantiates the API once over a list of N distinct types is
+generated and compiled on its own. The wall time, the peak resident set size of the compiler and (for Clang) the
+-ftime-trace totals are collected into a JSON and a CSV report.
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import time
+
+DEFAULT_SIZES = [8, 64, 256, 1024, 4096]
+
+PROLOGUE = """#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <argument_spec.hxx>
+#include <struct.hxx>
+#include <typelists.hxx>
+
+template <std::size_t Index>
+struct element_t
+{
+    int value{ static_cast<int>(Index) };
+};
+
+template <typename Type>
+struct is_even;
+
+template <std::size_t Index>
+struct is_even<element_t<Index>>
+{
+    static bool constexpr value = Index %% 2U == 0U;
+};
+
+template <std::size_t ...Indices>
+auto instantiate([[maybe_unused]] std::index_sequence<Indices...> indices)
+{
+    auto constexpr N = sizeof...(Indices);
+    return static_cast<int>(%s);
+}
+
+int main()
+{
+    return instantiate(std::make_index_sequence<%d>{});
+}
+"""
+
+# Each entry is the expression instantiated in the generated translation unit; N is the size of the type list and
+# Indices... expands to 0, 1, ..., N - 1. The baseline measures the cost of everything except the API itself.
+APIS = {
+    "baseline": "N",
+    "count": "pi::tl::count<element_t<N / 2U>, element_t<Indices>...>()",
+    "find_nth": "pi::tl::find_nth<element_t<N - 1U>, 1U, element_t<Indices>...>()",
+    "get": "pi::tl::get<N - 1U>(element_t<Indices>{}...).value",
+    "get_or_initialize": "pi::tl::get_or_initialize(element_t<N - 1U>{}, element_t<Indices>{}...).value",
+    "sort": "pi::tl::sort_t<pi::tl::typelist<element_t<N - 1U - Indices>...>>::size",
+    "canonical": "pi::tl::canonical_t<pi::tl::typelist<element_t<Indices / 2U>...>>::size",
+    "filter": "pi::tl::filter_t<is_even, pi::tl::typelist<element_t<Indices>...>>::size",
+    "transform": "pi::tl::transform_t<std::add_pointer_t, pi::tl::typelist<element_t<Indices>...>>::size",
+    "concat": "pi::tl::concat_t<pi::tl::typelist<element_t<Indices>>...>::size",
+    "partition": "pi::tl::partition_t<is_even, pi::tl::typelist<element_t<Indices>...>>::template at_t<1U>::size",
+    "slice": "pi::tl::slice_t<pi::tl::typelist<element_t<Indices>...>, N / 4U, N / 2U>::size",
+    "reverse": "pi::tl::reverse_t<pi::tl::typelist<element_t<Indices>...>>::size",
+    "struct_t": "pi::tl::struct_t<element_t<Indices>...>{ element_t<0U>{} }.template get<element_t<N - 1U>>().value",
+    "argument_spec": "pi::tl::argument_spec<pi::tl::field<element_t<Indices>>...>::parse(element_t<N - 1U - Indices>{}...).template get<element_t<0U>>().value",
+}
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--compiler", required=True, help="the C++ compiler to benchmark")
+    parser.add_argument("--compiler-id", default="GNU", help="CMake's compiler ID (GNU, Clang, AppleClang, MSVC)")
+    parser.add_argument("--include", action="append", default=[], help="include directory (repeatable)")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag (repeatable)")
+    parser.add_argument("--output", required=True, help="directory for the generated sources and the reports")
+    parser.add_argument("--sizes", type=int, nargs="+", default=DEFAULT_SIZES, help="sizes of the type lists")
+    parser.add_argument("--timeout", type=float, default=300.0, help="seconds after which a compilation is abandoned")
+    parser.add_argument("--apis", nargs="+", default=list(APIS), choices=list(APIS), help="APIs to benchmark")
+    return parser.parse_args()
+
+
+def command_line(arguments, source, target):
+    if arguments.compiler_id == "MSVC":
+        return ([arguments.compiler, "/nologo", "/std:c++20", "/c", "/EHsc", "/O2", source, "/Fo" + target]
+                + ["/I" + include for include in arguments.include] + arguments.flag)
+
+    command = ([arguments.compiler, "-std=c++20", "-O2", "-c", source, "-o", target]
+               + ["-I" + include for include in arguments.include] + arguments.flag)
+    if arguments.compiler_id in ("Clang", "AppleClang"):
+        command.append("-ftime-trace")
+    return command
+
+
+def compile_and_measure(command, log, timeout):
+    """
+    Returns the status, the wall time in seconds and the peak RSS in KiB of the compiler (None where the platform does not
+    report it). The compiler's diagnostics are written to log.
+    """
+    with open(log, "w", encoding="utf-8") as diagnostics:
+        start = time.perf_counter()
+        process = subprocess.Popen(command, stdout=diagnostics, stderr=subprocess.STDOUT)
+        if not hasattr(os, "wait4"):
+            try:
+                process.wait(timeout=timeout)
+            except subprocess.TimeoutExpired:
+                process.kill()
+                process.wait()
+                return "timeout", time.perf_counter() - start, None
+            return "ok" if process.returncode == 0 else "failed", time.perf_counter() - start, None
+
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            wall_time = time.perf_counter() - start
+            if pid != 0:
+                break
+            if wall_time > timeout:
+                process.kill()
+                os.wait4(process.pid, 0)
+                return "timeout", wall_time, None
+            time.sleep(0.005)
+
+    process.returncode = os.waitstatus_to_exitcode(status)
+    peak_rss = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    return "ok" if process.returncode == 0 else "failed", wall_time, peak_rss
+
+
+def summarize_time_trace(path):
+    """Sums the 'Total ...' events of a Clang -ftime-trace file, in milliseconds."""
+    if not os.path.exists(path):
+        return {}
+    with open(path, encoding="utf-8") as trace:
+        events = json.load(trace).get("traceEvents", [])
+    totals = {}
+    for event in events:
+        name = event.get("name", "")
+        if name.startswith("Total "):
+            totals[name[len("Total "):]] = totals.get(name[len("Total "):], 0.0) + event.get("dur", 0) / 1000.0
+    return totals
+
+
+def main():
+    arguments = parse_arguments()
+    sources = os.path.join(arguments.output, "sources")
+    os.makedirs(sources, exist_ok=True)
+
+    results = []
+    for api in arguments.apis:
+        for size in arguments.sizes:
+            stem = os.path.join(sources, "%s_%d" % (api, size))
+            with open(stem + ".cxx", "w", encoding="utf-8") as source:
+                source.write(PROLOGUE % (APIS[api], size))
+
+            target = stem + (".obj" if arguments.compiler_id == "MSVC" else ".o")
+            status, wall_time, peak_rss = compile_and_measure(command_line(arguments, stem + ".cxx", target), stem + ".log",
+                                                              arguments.timeout)
+            result = {
+                "api": api,
+                "size": size,
+                "status": status,
+                "wall_time_s": round(wall_time, 3),
+                "peak_rss_kib": peak_rss,
+                "time_trace_ms": summarize_time_trace(stem + ".json"),
+            }
+            results.append(result)
+            print("%-20s N=%-5d %-7s %8.3f s %10s KiB" % (api, size, status, wall_time, peak_rss), flush=True)
+            if status == "failed":
+                print("    see %s" % (stem + ".log"), flush=True)
+
+    report = {"compiler": arguments.compiler, "compiler_id": arguments.compiler_id, "results": results}
+    with open(os.path.join(arguments.output, "compile_benchmarks.json"), "w", encoding="utf-8") as json_report:
+        json.dump(report, json_report, indent=2)
+
+    trace_columns = sorted({name for result in results for name in result["time_trace_ms"]})
+    with open(os.path.join(arguments.output, "compile_benchmarks.csv"), "w", newline="", encoding="utf-8") as csv_report:
+        writer = csv.writer(csv_report)
+        writer.writerow(["api", "size", "status", "wall_time_s", "peak_rss_kib"] + trace_columns)
+        for result in results:
+            writer.writerow([result["api"], result["size"], result["status"], result["wall_time_s"], result["peak_rss_kib"]]
+                            + [result["time_trace_ms"].get(name, "") for name in trace_columns])
+
+    print("Reports written to %s" % arguments.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
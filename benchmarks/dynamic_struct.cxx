@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <any>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+
+#include <dynamic_struct.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, pi::td::tag<"benchmark.x">>;
+    using y_t = pi::td::typedecl<double, pi::td::tag<"benchmark.y">>;
+    using hp_t = pi::td::typedecl<int, pi::td::tag<"benchmark.hp">>;
+    using name_t = pi::td::typedecl<std::string, pi::td::tag<"benchmark.name">>;
+}
+
+TEST_CASE("Dynamic struct, against an unordered_map of std::any keyed by std::type_index", "[benchmark]")
+{
+    auto any_map = std::unordered_map<std::type_index, std::any>{};
+    any_map.emplace(typeid(x_t), x_t{ 1.0 });
+    any_map.emplace(typeid(y_t), y_t{ 2.0 });
+    any_map.emplace(typeid(hp_t), hp_t{ 3 });
+    any_map.emplace(typeid(name_t), name_t{ "name" });
+
+    auto dynamic = pi::tl::dynamic_struct{};
+    dynamic.set(x_t{ 1.0 });
+    dynamic.set(y_t{ 2.0 });
+    dynamic.set(hp_t{ 3 });
+    dynamic.set(name_t{ "name" });
+
+    BENCHMARK("unordered_map<type_index, any> get")
+    {
+        return static_cast<double>(std::any_cast<x_t &>(any_map.at(typeid(x_t)))) + std::any_cast<hp_t &>(any_map.at(typeid(hp_t)));
+    };
+
+    BENCHMARK("dynamic_struct get")
+    {
+        return static_cast<double>(dynamic.get<x_t>()) + dynamic.get<hp_t>();
+    };
+
+    BENCHMARK("unordered_map<type_index, any> build")
+    {
+        auto map = std::unordered_map<std::type_index, std::any>{};
+        map.emplace(typeid(x_t), x_t{ 1.0 });
+        map.emplace(typeid(y_t), y_t{ 2.0 });
+        map.emplace(typeid(hp_t), hp_t{ 3 });
+        return map.size();
+    };
+
+    BENCHMARK("dynamic_struct build")
+    {
+        auto fields = pi::tl::dynamic_struct{};
+        fields.set(x_t{ 1.0 });
+        fields.set(y_t{ 2.0 });
+        fields.set(hp_t{ 3 });
+        return fields.size();
+    };
+}
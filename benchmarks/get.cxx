@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstddef>
+#include <vector>
+
+#include <typelists.hxx>
+using namespace pi::tl;
+
+namespace
+{
+    // The arguments of a function taking 8 arguments, alternately int and double; their values are only known at run time.
+    // They are read into locals before the benchmarks, so that the raw code and the library are given the same values and
+    // only differ by how they select one.
+    struct arguments_t
+    {
+        std::vector<double> values{ 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0 };
+
+        [[nodiscard]] int i(size_t const index) const { return static_cast<int>(values[index]); }
+        [[nodiscard]] double d(size_t const index) const { return values[index]; }
+    };
+
+    // The hand-written equivalent of get(index, ...): a switch over the arguments.
+    double raw_get(size_t const index, int const i0, double const d1, int const i2, double const d3, int const i4, double const d5, int const i6, double const d7)
+    {
+        switch (index)
+        {
+            case 0U: return i0;
+            case 1U: return d1;
+            case 2U: return i2;
+            case 3U: return d3;
+            case 4U: return i4;
+            case 5U: return d5;
+            case 6U: return i6;
+            default: return d7;
+        }
+    }
+}
+
+TEST_CASE("get, against the raw argument", "[benchmark]")
+{
+    auto const a = arguments_t{};
+    auto const i0 = a.i(0U);
+    auto const d1 = a.d(1U);
+    auto const i2 = a.i(2U);
+    auto const d3 = a.d(3U);
+    auto const i4 = a.i(4U);
+    auto const d5 = a.d(5U);
+    auto const i6 = a.i(6U);
+    auto const d7 = a.d(7U);
+
+    BENCHMARK("raw argument")
+    {
+        return d7;
+    };
+
+    BENCHMARK("get<Index>")
+    {
+        return get<7U>(i0, d1, i2, d3, i4, d5, i6, d7);
+    };
+
+    auto index = size_t{ 0 };
+    BENCHMARK("raw switch on the index")
+    {
+        index = (index + 1U) % 8U;
+        return raw_get(index, i0, d1, i2, d3, i4, d5, i6, d7);
+    };
+
+    index = 0U;
+    BENCHMARK("get(index)")
+    {
+        index = (index + 1U) % 8U;
+        return get(index, i0, d1, i2, d3, i4, d5, i6, d7);
+    };
+}
+
+TEST_CASE("get_or_initialize and get_or_invoke, against the raw argument or default", "[benchmark]")
+{
+    auto const a = arguments_t{};
+    auto const i0 = a.i(0U);
+    auto const d1 = a.d(1U);
+    auto const i2 = a.i(2U);
+    auto const d3 = a.d(3U);
+    auto const i4 = a.i(4U);
+    auto const d5 = a.d(5U);
+    auto const i6 = a.i(6U);
+    auto const d7 = a.d(7U);
+
+    BENCHMARK("raw argument (present)")
+    {
+        return d3;
+    };
+
+    BENCHMARK("get_or_initialize (present)")
+    {
+        return get_or_initialize(-1.0, i0, d3, i2);
+    };
+
+    BENCHMARK("get_or_initialize<strict> (present)")
+    {
+        return get_or_initialize<matching::strict>(-1.0, i0, d3, i2);
+    };
+
+    BENCHMARK("raw default (absent)")
+    {
+        return -1.0 + i0;
+    };
+
+    BENCHMARK("get_or_initialize (absent)")
+    {
+        return get_or_initialize(-1.0, i0, i2) + i0;
+    };
+
+    BENCHMARK("get_nth_or_initialize<Nth> (present)")
+    {
+        return get_nth_or_initialize<2U>(-1.0, d1, i0, d3, i2);
+    };
+
+    BENCHMARK("get_or_invoke (present)")
+    {
+        return get_or_invoke([] { return -1.0; }, i0, d3, i2);
+    };
+
+    BENCHMARK("get_nth_or_invoke<Nth> (absent)")
+    {
+        return get_nth_or_invoke<3U>([] { return -1.0; }, d1, i0, d3) + i0;
+    };
+
+    auto nth = size_t{ 0 };
+    BENCHMARK("raw switch on nth")
+    {
+        nth = nth % 5U + 1U;
+        return nth == 1U ? d1 : nth == 2U ? d3 : nth == 3U ? d5 : nth == 4U ? d7 : -1.0;
+    };
+
+    nth = 0U;
+    BENCHMARK("get_nth_or_initialize(nth)")
+    {
+        nth = nth % 5U + 1U;
+        return get_nth_or_initialize(nth, -1.0, i0, d1, i2, d3, i4, d5, i6, d7);
+    };
+}
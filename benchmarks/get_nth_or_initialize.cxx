@@ -0,0 +1,84 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <typelists.hxx>
+using namespace pi::tl;
+
+namespace legacy
+{
+    // The recursive implementation of the run-time get_nth_or_initialize, before the positions were precomputed.
+    template<typename SearchedType, typename Type>
+    [[nodiscard]] auto constexpr get_or_initialize(size_t const nth, [[maybe_unused]] SearchedType default_value, [[maybe_unused]] Type &&argument)
+    {
+        if constexpr (!std::is_same_v<Type, SearchedType>)
+            return default_value;
+        else
+        {
+            if (nth != 1ULL)
+                return default_value;
+
+            return std::forward<Type>(argument);
+        }
+    }
+
+    template<typename SearchedType, typename Head, typename ...TypeList>
+    [[nodiscard]] auto constexpr get_or_initialize(size_t const nth, SearchedType default_value, Head &&first, [[maybe_unused]] TypeList &&...rest)
+    {
+        if (nth > pi::tl::internal::count<SearchedType, Head, TypeList...>())
+            return default_value;
+
+        if constexpr (std::is_same_v<Head, SearchedType>)
+        {
+            if (nth == 1ULL)
+                return std::forward<Head>(first);
+
+            return get_or_initialize<SearchedType, TypeList...>(nth - 1ULL, std::forward<SearchedType>(default_value), std::forward<TypeList>(rest)...);
+        }
+        else
+            return get_or_initialize<SearchedType, TypeList...>(nth, std::forward<SearchedType>(default_value), std::forward<TypeList>(rest)...);
+    }
+}
+
+namespace
+{
+    template <size_t Index>
+    using argument_t = std::conditional_t<Index % 2U == 0U, int, double>;
+
+    template <size_t ...Indices>
+    void benchmark_get_nth_or_initialize(std::index_sequence<Indices...>)
+    {
+        auto constexpr size = sizeof...(Indices);
+        auto const suffix = " (" + std::to_string(size) + " arguments)";
+
+        // The values of the arguments are only known at run time, as they would be in a factory function.
+        auto const values = std::vector<double>{ static_cast<double>(Indices)... };
+
+        // The index goes through all the int arguments and one past them (which returns the default).
+        auto nth = size_t{ 0 };
+        BENCHMARK("recursive" + suffix)
+        {
+            nth = nth % (size / 2U + 1U) + 1U;
+            return legacy::get_or_initialize<int, argument_t<Indices>...>(nth, -1, static_cast<argument_t<Indices>>(values[Indices])...);
+        };
+
+        nth = 0U;
+        BENCHMARK("position table" + suffix)
+        {
+            nth = nth % (size / 2U + 1U) + 1U;
+            return get_nth_or_initialize<matching::strict>(nth, -1, static_cast<argument_t<Indices>>(values[Indices])...);
+        };
+    }
+}
+
+TEST_CASE("get_nth_or_initialize (index known at run time)", "[benchmark]")
+{
+    benchmark_get_nth_or_initialize(std::make_index_sequence<4>{});
+    benchmark_get_nth_or_initialize(std::make_index_sequence<8>{});
+    benchmark_get_nth_or_initialize(std::make_index_sequence<16>{});
+    benchmark_get_nth_or_initialize(std::make_index_sequence<32>{});
+    benchmark_get_nth_or_initialize(std::make_index_sequence<64>{});
+}
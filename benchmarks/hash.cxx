@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include <struct.hxx>
+
+namespace
+{
+    using row_id_t = pi::td::typedecl<int64_t, pi::td::tag<"benchmark.hash.row_id">, pi::td::comparison>;
+    using column_t = pi::td::typedecl<int32_t, pi::td::tag<"benchmark.hash.column">>;
+    using weight_t = pi::td::typedecl<double, pi::td::tag<"benchmark.hash.weight">>;
+
+    // Hashed in a single pass over its bytes, and field by field (a double has two zeros).
+    using cell_t = pi::tl::struct_t<row_id_t, column_t, column_t>;
+    using weighted_cell_t = pi::tl::struct_t<row_id_t, weight_t>;
+
+    size_t constexpr row_count = 10'000U;
+
+    // A join table is rebuilt from scratch, so that each insertion that grows it rehashes every key already in it.
+    template <typename Key, typename Hash>
+    auto build_join_table(std::vector<Key> const &keys)
+    {
+        auto table = std::unordered_map<Key, size_t, Hash, std::equal_to<>>{};
+        for (auto index = size_t{ 0 }; index < keys.size(); ++index)
+            table.emplace(keys[index], index);
+
+        return table.size();
+    }
+
+    template <typename Key>
+    auto sequential_keys()
+    {
+        auto keys = std::vector<Key>{};
+        keys.reserve(row_count);
+        for (auto index = size_t{ 0 }; index < row_count; ++index)
+            keys.emplace_back(static_cast<int64_t>(index));
+
+        return keys;
+    }
+}
+
+TEST_CASE("Join table keyed by 10'000 sequential IDs", "[benchmark]")
+{
+    auto const raw_keys = sequential_keys<int64_t>();
+    auto const keys = sequential_keys<row_id_t>();
+
+    BENCHMARK("int64_t, std::hash")
+    {
+        return build_join_table<int64_t, std::hash<int64_t>>(raw_keys);
+    };
+
+    BENCHMARK("typedecl, std::hash")
+    {
+        return build_join_table<row_id_t, std::hash<row_id_t>>(keys);
+    };
+
+    BENCHMARK("typedecl, transparent_hash")
+    {
+        return build_join_table<row_id_t, pi::td::transparent_hash>(keys);
+    };
+
+    auto table = std::unordered_map<row_id_t, size_t, pi::td::transparent_hash, std::equal_to<>>{};
+    for (auto index = size_t{ 0 }; index < keys.size(); ++index)
+        table.emplace(keys[index], index);
+
+    BENCHMARK("find by the underlying value")
+    {
+        auto found = size_t{ 0 };
+        for (auto id = int64_t{ 0 }; id < static_cast<int64_t>(row_count); id += 7)
+            found += table.count(id);
+        return found;
+    };
+}
+
+TEST_CASE("Hash of a struct, as bytes and field by field", "[benchmark]")
+{
+    auto cells = std::vector<cell_t>{};
+    auto weighted_cells = std::vector<weighted_cell_t>{};
+    for (auto index = int64_t{ 0 }; index < static_cast<int64_t>(row_count); ++index)
+    {
+        cells.emplace_back(row_id_t{ index }, column_t{ static_cast<int32_t>(index % 16) }, column_t{ 1 });
+        weighted_cells.emplace_back(row_id_t{ index }, weight_t{ static_cast<double>(index % 16) });
+    }
+
+    BENCHMARK("struct_t<int64_t, int32_t, int32_t>, as bytes")
+    {
+        auto hash = size_t{ 0 };
+        for (auto const &cell : cells)
+            hash ^= std::hash<cell_t>{}(cell);
+        return hash;
+    };
+
+    BENCHMARK("struct_t<int64_t, double>, field by field")
+    {
+        auto hash = size_t{ 0 };
+        for (auto const &cell : weighted_cells)
+            hash ^= std::hash<weighted_cell_t>{}(cell);
+        return hash;
+    };
+}
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+"""
+Compares the build time of a project that includes the PiTypeLists headers with one that imports the pi.typelists module.
+
+A synthetic CMake project of N translation units (500 by default) is generated twice: each translation unit declares a few
+typedecls and a struct_t of them, and either includes struct.hxx and typedecl.hxx or imports pi.typelists. Both projects
+are configured, then built from scratch with the same compiler, generator and number of jobs; the module is built as part
+of the second one. The wall times are written to a JSON and a CSV report.
+
+Building the module requires CMake 3.28, Ninja 1.11 (or Visual Studio 17.4) and a compiler that scans module
+dependencies: Clang 16, GCC 14 or MSVC 19.34.
+"""
+
+import argparse
+import csv
+import json
+import os
+import shutil
+import subprocess
+import sys
+import time
+
+DEFAULT_UNITS = 500
+
+PROJECT = """cmake_minimum_required(VERSION 3.28)
+project(PiTypeListsModuleBenchmark LANGUAGES CXX)
+
+set(CMAKE_CXX_STANDARD 20)
+set(CMAKE_CXX_STANDARD_REQUIRED ON)
+set(CMAKE_CXX_EXTENSIONS OFF)
+
+add_library(pi_typelists INTERFACE)
+target_include_directories(pi_typelists INTERFACE "%(include)s" "%(internal)s")
+%(module)s
+file(GLOB units CONFIGURE_DEPENDS "${CMAKE_CURRENT_SOURCE_DIR}/units/*.cxx")
+add_library(units OBJECT ${units})
+target_link_libraries(units PRIVATE %(library)s)
+"""
+
+MODULE = """
+add_library(pi_typelists_module)
+target_sources(pi_typelists_module PUBLIC FILE_SET CXX_MODULES BASE_DIRS "%(modules)s" FILES "%(modules)s/pi.typelists.cppm")
+target_link_libraries(pi_typelists_module PUBLIC pi_typelists)
+"""
+
+# The same code in both forms; %(import)s is either the #include lines or the import declaration.
+UNIT = """%(import)s
+
+namespace unit_%(index)d
+{
+    using identifier_t = pi::td::typedecl<int, pi::td::tag<"identifier_%(index)d">, pi::td::comparison>;
+    using mass_t = pi::td::typedecl<double, pi::td::tag<"mass_%(index)d">, pi::td::arithmetic>;
+    using name_t = pi::td::typedecl<char const *, pi::td::tag<"name_%(index)d">>;
+    using record_t = pi::tl::struct_t<identifier_t, mass_t, name_t>;
+
+    double total_mass(record_t &first, record_t &second)
+    {
+        return static_cast<double>(first.get<mass_t>() + second.get<mass_t>());
+    }
+
+    bool same_identifier(record_t &first, record_t &second)
+    {
+        return first.get<identifier_t>() == second.get<identifier_t>();
+    }
+}
+"""
+
+FORMS = {
+    "headers": "#include <struct.hxx>\n#include <typedecl.hxx>",
+    "module": "import pi.typelists;",
+}
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--cmake", default="cmake", help="the CMake executable")
+    parser.add_argument("--generator", default="Ninja", help="the CMake generator (it must support C++20 modules)")
+    parser.add_argument("--compiler", required=True, help="the C++ compiler")
+    parser.add_argument("--source", required=True, help="the root of the PiTypeLists source tree")
+    parser.add_argument("--output", required=True, help="directory for the generated projects and the reports")
+    parser.add_argument("--units", type=int, default=DEFAULT_UNITS, help="number of translation units")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count() or 1, help="number of parallel build jobs")
+    parser.add_argument("--forms", nargs="+", default=list(FORMS), choices=list(FORMS), help="forms to build")
+    return parser.parse_args()
+
+
+def generate(arguments, form):
+    """Writes the synthetic project of the given form and returns its directory."""
+    root = os.path.join(arguments.output, form)
+    shutil.rmtree(root, ignore_errors=True)
+    os.makedirs(os.path.join(root, "units"))
+
+    paths = {name: os.path.join(os.path.abspath(arguments.source), name).replace("\\", "/") for name in ("include", "internal", "modules")}
+    with open(os.path.join(root, "CMakeLists.txt"), "w", encoding="utf-8") as project:
+        project.write(PROJECT % {
+            "include": paths["include"],
+            "internal": paths["internal"],
+            "module": MODULE % paths if form == "module" else "",
+            "library": "pi_typelists_module" if form == "module" else "pi_typelists",
+        })
+
+    for index in range(arguments.units):
+        with open(os.path.join(root, "units", "unit_%04d.cxx" % index), "w", encoding="utf-8") as unit:
+            unit.write(UNIT % {"import": FORMS[form], "index": index})
+
+    return root
+
+
+def run(command, log):
+    """Runs command, appending its output to log; returns the status and the wall time in seconds."""
+    with open(log, "a", encoding="utf-8") as output:
+        start = time.perf_counter()
+        returncode = subprocess.call(command, stdout=output, stderr=subprocess.STDOUT)
+        return "ok" if returncode == 0 else "failed", time.perf_counter() - start
+
+
+def main():
+    arguments = parse_arguments()
+    os.makedirs(arguments.output, exist_ok=True)
+
+    results = []
+    for form in arguments.forms:
+        root = generate(arguments, form)
+        build = os.path.join(root, "build")
+        log = os.path.join(root, "build.log")
+        status, configure_time = run([arguments.cmake, "-S", root, "-B", build, "-G", arguments.generator,
+                                      "-DCMAKE_CXX_COMPILER=" + arguments.compiler, "-DCMAKE_BUILD_TYPE=Release"], log)
+        build_time = None
+        if status == "ok":
+            status, build_time = run([arguments.cmake, "--build", build, "--parallel", str(arguments.jobs)], log)
+
+        results.append({
+            "form": form,
+            "units": arguments.units,
+            "jobs": arguments.jobs,
+            "status": status,
+            "configure_time_s": round(configure_time, 3),
+            "build_time_s": None if build_time is None else round(build_time, 3),
+        })
+        print("%-8s %d units %-7s %10s s" % (form, arguments.units, status, "-" if build_time is None else "%.3f" % build_time),
+              flush=True)
+        if status == "failed":
+            print("    see %s" % log, flush=True)
+
+    report = {"compiler": arguments.compiler, "generator": arguments.generator, "results": results}
+    with open(os.path.join(arguments.output, "module_benchmarks.json"), "w", encoding="utf-8") as json_report:
+        json.dump(report, json_report, indent=2)
+
+    with open(os.path.join(arguments.output, "module_benchmarks.csv"), "w", newline="", encoding="utf-8") as csv_report:
+        writer = csv.writer(csv_report)
+        writer.writerow(["form", "units", "jobs", "status", "configure_time_s", "build_time_s"])
+        for result in results:
+            writer.writerow([result["form"], result["units"], result["jobs"], result["status"], result["configure_time_s"],
+                             result["build_time_s"]])
+
+    print("Reports written to %s" % arguments.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+Runs the benchmarks executable and writes its results to a JSON and a CSV report.
+
+The Catch2 benchmarks are run with the XML reporter; the mean, the bounds of its confidence interval and the standard
+deviation of each benchmark (in nanoseconds) are collected per test case. Given the JSON report of a previous run (e.g. of
+the previous release), the change of each mean is printed as well.
+"""
+
+import argparse
+import csv
+import json
+import os
+import subprocess
+import sys
+import xml.etree.ElementTree as ElementTree
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--executable", required=True, help="the benchmarks executable")
+    parser.add_argument("--output", required=True, help="directory for the reports")
+    parser.add_argument("--compare", help="JSON report of a previous run to compare the means with")
+    parser.add_argument("--catch-argument", action="append", default=[],
+                        help="extra argument of the executable, e.g. a test case filter (repeatable)")
+    return parser.parse_args()
+
+
+def collect(xml_output):
+    """The results of every benchmark in the XML report of Catch2, in the order they were run."""
+    results = []
+    for test_case in ElementTree.fromstring(xml_output).iter("TestCase"):
+        for benchmark in test_case.iter("BenchmarkResults"):
+            mean = benchmark.find("mean")
+            deviation = benchmark.find("standardDeviation")
+            results.append({
+                "test_case": test_case.get("name"),
+                "benchmark": benchmark.get("name"),
+                "samples": int(benchmark.get("samples")),
+                "iterations": int(benchmark.get("iterations")),
+                "mean_ns": float(mean.get("value")),
+                "mean_lower_bound_ns": float(mean.get("lowerBound")),
+                "mean_upper_bound_ns": float(mean.get("upperBound")),
+                "standard_deviation_ns": float(deviation.get("value")),
+            })
+    return results
+
+
+def compare(results, path):
+    with open(path, encoding="utf-8") as previous_report:
+        previous = {(result["test_case"], result["benchmark"]): result["mean_ns"] for result in json.load(previous_report)["results"]}
+
+    for result in results:
+        before = previous.get((result["test_case"], result["benchmark"]))
+        if before:
+            print("%-60s %12.3f ns -> %12.3f ns %+8.1f%%" % (result["benchmark"][:60], before, result["mean_ns"],
+                                                           100.0 * (result["mean_ns"] - before) / before))
+
+
+def main():
+    arguments = parse_arguments()
+    os.makedirs(arguments.output, exist_ok=True)
+
+    command = [arguments.executable, "[benchmark]", "--reporter", "xml"] + arguments.catch_argument
+    process = subprocess.run(command, stdout=subprocess.PIPE, check=False)
+    if process.returncode != 0:
+        print("%s exited with %d" % (arguments.executable, process.returncode), file=sys.stderr)
+        return process.returncode
+
+    results = collect(process.stdout)
+    with open(os.path.join(arguments.output, "runtime_benchmarks.json"), "w", encoding="utf-8") as json_report:
+        json.dump({"executable": arguments.executable, "results": results}, json_report, indent=2)
+
+    fields = ["test_case", "benchmark", "samples", "iterations", "mean_ns", "mean_lower_bound_ns", "mean_upper_bound_ns",
+              "standard_deviation_ns"]
+    with open(os.path.join(arguments.output, "runtime_benchmarks.csv"), "w", newline="", encoding="utf-8") as csv_report:
+        writer = csv.DictWriter(csv_report, fieldnames=fields)
+        writer.writeheader()
+        writer.writerows(results)
+
+    if arguments.compare:
+        compare(results, arguments.compare)
+
+    print("%d benchmarks, reports written to %s" % (len(results), arguments.output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
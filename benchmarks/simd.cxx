@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+#include <vector>
+
+#include <simd.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, TAG(BenchmarkX)>;
+
+    template <typename Type>
+    auto make_values(size_t const size, double const scale)
+    {
+        auto values = std::vector<Type>{};
+        values.reserve(size);
+        for (auto index = size_t{ 0 }; index < size; ++index)
+            values.emplace_back(scale * static_cast<double>(index % 1024U));
+
+        return values;
+    }
+
+    void benchmark_kernels(size_t const size)
+    {
+        auto const suffix = " (" + std::to_string(size) + " values)";
+
+        auto const raw_left = make_values<double>(size, 0.5);
+        auto const raw_right = make_values<double>(size, 0.25);
+        auto raw_output = std::vector<double>(size);
+
+        auto const left = make_values<x_t>(size, 0.5);
+        auto const right = make_values<x_t>(size, 0.25);
+        auto output = std::vector<x_t>(size);
+
+        BENCHMARK("raw double fma" + suffix)
+        {
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                raw_output[index] = raw_left[index] * raw_right[index] + raw_left[index];
+
+            return raw_output.back();
+        };
+
+        BENCHMARK("typedecl fma" + suffix)
+        {
+            pi::td::simd::fma(left, right, left, output);
+            return static_cast<double>(output.back());
+        };
+
+        BENCHMARK("raw double clamp" + suffix)
+        {
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                raw_output[index] = raw_left[index] < 64.0 ? 64.0 : (raw_left[index] > 256.0 ? 256.0 : raw_left[index]);
+
+            return raw_output.back();
+        };
+
+        BENCHMARK("typedecl clamp" + suffix)
+        {
+            pi::td::simd::clamp(left, x_t{ 64.0 }, x_t{ 256.0 }, output);
+            return static_cast<double>(output.back());
+        };
+
+        BENCHMARK("raw double sum" + suffix)
+        {
+            auto sum = 0.0;
+            for (auto const value : raw_left)
+                sum += value;
+
+            return sum;
+        };
+
+        BENCHMARK("typedecl sum" + suffix)
+        {
+            return static_cast<double>(pi::td::simd::sum(left));
+        };
+
+        BENCHMARK("raw double maximum" + suffix)
+        {
+            auto maximum = raw_left.front();
+            for (auto const value : raw_left)
+                maximum = value > maximum ? value : maximum;
+
+            return maximum;
+        };
+
+        BENCHMARK("typedecl maximum" + suffix)
+        {
+            return static_cast<double>(pi::td::simd::maximum(left));
+        };
+    }
+}
+
+TEST_CASE("SIMD kernels over columns of typedecls, against raw double loops", "[benchmark]")
+{
+    benchmark_kernels(1024U);
+    benchmark_kernels(1024U * 1024U);
+}
@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <struct.hxx>
+
+namespace
+{
+    template <size_t Index>
+    struct field_t
+    {
+        int value{ static_cast<int>(Index) };
+    };
+
+    template <size_t ...Indices>
+    auto records(std::index_sequence<Indices...>) -> std::pair<pi::tl::struct_t<field_t<Indices>...>, std::tuple<field_t<Indices>...>>;
+
+    using x_t = pi::td::typedecl<double, pi::td::tag<"benchmark.struct.x">>;
+    using y_t = pi::td::typedecl<double, pi::td::tag<"benchmark.struct.y">>;
+    using z_t = pi::td::typedecl<double, pi::td::tag<"benchmark.struct.z">>;
+    using hp_t = pi::td::typedecl<int, pi::td::tag<"benchmark.struct.hp">>;
+
+    struct raw_record_t
+    {
+        double x{};
+        double y{};
+        double z{};
+        int hp{};
+    };
+
+    // A record of 50 fields, and the std::tuple that struct_t used to store its fields in.
+    using records_t = decltype(records(std::make_index_sequence<50U>{}));
+    using record_t = records_t::first_type;
+    using tuple_t = records_t::second_type;
+}
+
+TEST_CASE("Struct of 50 fields, against the std::tuple it used to be stored in", "[benchmark]")
+{
+    auto tuple = tuple_t{};
+    auto record = record_t{};
+
+    BENCHMARK("std::tuple get")
+    {
+        return std::get<field_t<0U>>(tuple).value + std::get<field_t<25U>>(tuple).value + std::get<field_t<49U>>(tuple).value;
+    };
+
+    BENCHMARK("struct_t get")
+    {
+        return record.get<field_t<0U>>().value + record.get<field_t<25U>>().value + record.get<field_t<49U>>().value;
+    };
+
+    BENCHMARK("std::tuple set")
+    {
+        std::get<field_t<0U>>(tuple) = field_t<0U>{ 1 };
+        std::get<field_t<49U>>(tuple) = field_t<49U>{ 2 };
+        return std::get<field_t<25U>>(tuple).value;
+    };
+
+    BENCHMARK("struct_t set")
+    {
+        record.set(field_t<0U>{ 1 });
+        record.set(field_t<49U>{ 2 });
+        return record.get<field_t<25U>>().value;
+    };
+
+    BENCHMARK("std::tuple construction")
+    {
+        auto built = tuple_t{};
+        std::get<field_t<49U>>(built) = field_t<49U>{ 1 };
+        std::get<field_t<0U>>(built) = field_t<0U>{ 2 };
+        return std::get<field_t<25U>>(built).value;
+    };
+
+    BENCHMARK("struct_t construction")
+    {
+        auto built = record_t{ field_t<49U>{ 1 }, field_t<0U>{ 2 } };
+        return built.get<field_t<25U>>().value;
+    };
+}
+
+TEST_CASE("Struct, against a hand-written struct", "[benchmark]")
+{
+    auto values = std::vector<double>{ 1.0, 2.0, 3.0, 4.0 };
+    auto raw = raw_record_t{};
+    auto record = pi::tl::struct_t<x_t, y_t, z_t, hp_t>{};
+
+    BENCHMARK("hand-written struct construction")
+    {
+        auto built = raw_record_t{ values[0], values[1], values[2], static_cast<int>(values[3]) };
+        return built.x + built.hp;
+    };
+
+    BENCHMARK("struct_t construction")
+    {
+        auto built = pi::tl::struct_t<x_t, y_t, z_t, hp_t>{ hp_t{ static_cast<int>(values[3]) }, x_t{ values[0] }, y_t{ values[1] }, z_t{ values[2] } };
+        return built.get<x_t>() + built.get<hp_t>();
+    };
+
+    BENCHMARK("hand-written struct get and set")
+    {
+        raw.y = values[1];
+        raw.hp = raw.hp + 1;
+        return raw.x + raw.y + raw.z;
+    };
+
+    BENCHMARK("struct_t get and set")
+    {
+        record.set(y_t{ values[1] });
+        record.set(hp_t{ record.get<hp_t>() + 1 });
+        return record.get<x_t>() + record.get<y_t>() + record.get<z_t>();
+    };
+}
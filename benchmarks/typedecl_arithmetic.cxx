@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <typedecl.hxx>
+
+namespace
+{
+    using position_t = pi::td::typedecl<double, TAG(BenchmarkPosition), pi::td::arithmetic, pi::td::comparison>;
+    using counter_t = pi::td::typedecl<int64_t, TAG(BenchmarkCounter), pi::td::arithmetic, pi::td::comparison>;
+
+    // One integration step, x += v * dt, clamped to [low, high]: the same code for the raw and for the strong type.
+    // std::clamp is used for double, the clamp of the comparison policy (found by ADL) for the strong type.
+    template <typename Position>
+    auto integrate(std::vector<Position> &positions, std::vector<Position> const &velocities, double const dt, Position const low, Position const high)
+    {
+        using std::clamp;
+        for (auto index = size_t{ 0 }; index < positions.size(); ++index)
+        {
+            positions[index] += velocities[index] * dt;
+            positions[index] = clamp(positions[index], low, high);
+        }
+
+        return positions.back();
+    }
+
+    template <typename Counter>
+    auto histogram(std::vector<Counter> const &values, Counter const buckets)
+    {
+        auto sum = Counter{};
+        for (auto const value : values)
+            sum += value % buckets;
+
+        return sum;
+    }
+
+    void benchmark_arithmetic(size_t const size)
+    {
+        auto const suffix = " (" + std::to_string(size) + " values)";
+
+        auto raw_positions = std::vector<double>(size);
+        auto const raw_velocities = std::vector<double>(size, 1.0);
+        auto positions = std::vector<position_t>(size);
+        auto const velocities = std::vector<position_t>(size, position_t{ 1.0 });
+
+        BENCHMARK("raw double integration" + suffix)
+        {
+            return integrate(raw_positions, raw_velocities, 0.01, -100.0, 100.0);
+        };
+
+        BENCHMARK("typedecl integration" + suffix)
+        {
+            return integrate(positions, velocities, 0.01, position_t{ -100.0 }, position_t{ 100.0 });
+        };
+
+        auto raw_counters = std::vector<int64_t>{};
+        auto counters = std::vector<counter_t>{};
+        for (auto index = size_t{ 0 }; index < size; ++index)
+        {
+            raw_counters.push_back(static_cast<int64_t>(index));
+            counters.emplace_back(static_cast<int64_t>(index));
+        }
+
+        BENCHMARK("raw int64_t modulo sum" + suffix)
+        {
+            return histogram(raw_counters, int64_t{ 7 });
+        };
+
+        BENCHMARK("typedecl modulo sum" + suffix)
+        {
+            return histogram(counters, counter_t{ 7 });
+        };
+    }
+}
+
+TEST_CASE("Strong arithmetic, against the raw type", "[benchmark]")
+{
+    benchmark_arithmetic(1024U);
+    benchmark_arithmetic(1024U * 1024U);
+}
+
+TEST_CASE("Strong type conversions, against the raw type", "[benchmark]")
+{
+    auto raw_values = std::vector<double>(1024U);
+    for (auto index = size_t{ 0 }; index < raw_values.size(); ++index)
+        raw_values[index] = static_cast<double>(index);
+
+    auto const positions = std::vector<position_t>(raw_values.begin(), raw_values.end());
+
+    BENCHMARK("raw double to double (1024 values)")
+    {
+        auto sum = 0.0;
+        for (auto const value : raw_values)
+            sum += value;
+
+        return sum;
+    };
+
+    BENCHMARK("typedecl to double (1024 values)")
+    {
+        auto sum = 0.0;
+        for (auto const position : positions)
+            sum += static_cast<double>(position);
+
+        return sum;
+    };
+
+    auto built = std::vector<position_t>(raw_values.size());
+    BENCHMARK("double to typedecl (1024 values)")
+    {
+        for (auto index = size_t{ 0 }; index < raw_values.size(); ++index)
+            built[index] = position_t{ raw_values[index] };
+
+        return built.back();
+    };
+}
@@ -0,0 +1,107 @@
+#ifndef PITYPELISTS_ARGUMENT_SPEC_HXX
+#define PITYPELISTS_ARGUMENT_SPEC_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include <struct.hxx>
+#include <tl_constants.hxx>
+#include <tl_count.hxx>
+#include <tl_field_initializer.hxx>
+#include <tl_indexed.hxx>
+#include <tl_tally.hxx>
+#include <typelists.hxx>
+
+namespace pi::tl
+{
+    /*!
+     * @brief A named argument of an argument_spec, and the field of the struct it is parsed into.
+     * @tparam Type The type of the argument and of the field
+     * @tparam Default The value of the field when the argument is absent: a value Type is constructed from, or a lazy
+     *         factory returning it, which is only called then (lazy{ [] { return Type{}; } }). The field is
+     *         value-initialized by default.
+     * @tparam Min The minimum number of arguments of type Type
+     * @tparam Max The maximum number of arguments of type Type; the field is constructed from the first one
+     */
+    template <typename Type, auto Default = internal::value_initialized{}, size_t Min = 0U, size_t Max = 1U>
+    struct field
+    {
+        static_assert(Min <= Max, "The minimum number of arguments of a field must not be greater than the maximum.");
+
+        using type = Type;
+        auto static constexpr default_value = Default;
+        size_t static constexpr min = Min;
+        size_t static constexpr max = Max;
+    };
+
+    /*! A field that must be given at least once, and at most Max times. */
+    template <typename Type, size_t Max = 1U>
+    using required = field<Type, internal::value_initialized{}, 1U, Max>;
+}
+
+namespace pi::tl::internal
+{
+    /*! Fails to compile, naming Field in the diagnostic, when Count is not within the bounds of Field. */
+    template <typename Field, size_t Count>
+    void consteval check_occurrences()
+    {
+        static_assert(Count >= Field::min, "Too few arguments of the type of this field.");
+        static_assert(Count <= Field::max, "Too many arguments of the type of this field.");
+    }
+
+    /*! The initializer of Field: from the argument at Position, or from its default when Position is npos. */
+    template <typename Field, int64_t Position, typename ...Arguments>
+    [[nodiscard]] auto constexpr argument_or_default([[maybe_unused]] Arguments &&...arguments)
+    {
+        using field_t = typename Field::type;
+        if constexpr (Position == npos)
+            return default_initializer<field_t, Field::default_value>{};
+        else
+            return field_initializer<field_t, type_at_t<Position, Arguments...>>{ internal::get<Position, Arguments...>(std::forward<Arguments>(arguments)...) };
+    }
+}
+
+namespace pi::tl
+{
+    /*!
+     * @brief The named arguments accepted by a function, in any order, and their defaults.
+     * @tparam Fields The fields (see field), with distinct types
+     * @note A spec with two fields of the same type (e.g. field<x_t, 1.0>, field<x_t, 2.0>) does not compile: an argument
+     *       could not be attributed to one of them.
+     */
+    template <typename ...Fields>
+    struct argument_spec
+    {
+        static_assert(((internal::count<std::decay_t<typename Fields::type>, std::decay_t<typename Fields::type>...>() == 1U) && ...),
+                      "The fields of an argument spec must have distinct types.");
+
+        /*! The struct the arguments are parsed into: a field per argument type, in the order of Fields. */
+        using struct_type = struct_t<typename Fields::type...>;
+
+        /*!
+         * @brief Validates the arguments against the spec and constructs each field of the result in place, from its
+         *        argument (relaxed matching) or from its default.
+         * @note The arguments are attributed to the fields in a single pass, at compile time, however many fields there are.
+         */
+        template <typename ...Arguments>
+        [[nodiscard]] auto static constexpr parse(Arguments &&...arguments)
+        {
+            return parse(std::index_sequence_for<Fields...>{}, std::forward<Arguments>(arguments)...);
+        }
+
+    private:
+        template <size_t ...Indices, typename ...Arguments>
+        [[nodiscard]] auto static constexpr parse(std::index_sequence<Indices...>, [[maybe_unused]] Arguments &&...arguments)
+        {
+            auto constexpr &tally = internal::tally<matching::relaxed, typelist<typename Fields::type...>, Arguments...>::value;
+            static_assert(tally.unmatched == 0U, "Each argument must have the type of a field of the spec.");
+            (internal::check_occurrences<Fields, tally.counts[Indices]>(), ...);
+
+            return struct_type(internal::in_declared_order, internal::argument_or_default<Fields, tally.first_positions[Indices]>(std::forward<Arguments>(arguments)...)...);
+        }
+    };
+}
+
+#endif //PITYPELISTS_ARGUMENT_SPEC_HXX
@@ -0,0 +1,457 @@
+#ifndef PITYPELISTS_CODEC_HXX
+#define PITYPELISTS_CODEC_HXX
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <struct.hxx>
+#include <tl_field_initializer.hxx>
+#include <tl_type_name.hxx>
+#include <typelists.hxx>
+
+namespace pi::tl
+{
+    /*!
+     * @brief How encode writes the records.
+     * Both encodings start with a 24 bytes header: the schema hash of the record (8 bytes), the encoding (4 bytes), 4 zero
+     * bytes, which keep the records as aligned as the buffer, and the number of records (8 bytes, so that a snapshot can
+     * hold more than 2^32 records). Everything is written in the byte order of the host.
+     */
+    enum class encoding : uint32_t
+    {
+        raw    /*! the records are copied byte for byte, in their in-memory layout; decoding needs the same schema */
+      , tagged /*! each field is preceded by its key and its size; decoding skips unknown fields and value-initializes
+                   missing ones, so fields can be added to or removed from the record between versions */
+    };
+
+    /*!
+     * @brief How the tagged encoding writes a field and reads it back.
+     * It is defined for the trivially copyable fields, copied byte for byte, and for the resizable contiguous containers
+     * of trivially copyable values (e.g. std::string, std::vector<int> and their typedecls), whose elements are copied.
+     * Specialize it for the other fields, with:
+     * - size_t static size(Field const &field): the number of bytes encode writes
+     * - void static encode(Field const &field, std::span<std::byte> bytes): writes the field into bytes, of that size
+     * - void static decode(std::span<std::byte const> bytes, Field &field): throws std::invalid_argument if the bytes
+     *   are not an encoded field
+     */
+    template <typename Field>
+    struct field_codec;
+}
+
+namespace pi::tl::internal
+{
+    template <typename Container>
+    concept bytewise_container = std::ranges::contiguous_range<Container> && std::ranges::sized_range<Container>
+                              && std::is_trivially_copyable_v<std::ranges::range_value_t<Container>>
+                              && !std::is_trivially_copyable_v<Container>
+                              && requires(Container &container, size_t const size) { container.resize(size); };
+
+    template <typename Field>
+    concept has_field_codec = requires(Field const &field, Field &decoded, std::span<std::byte> const output, std::span<std::byte const> const input)
+    {
+        { field_codec<Field>::size(field) } -> std::convertible_to<size_t>;
+        field_codec<Field>::encode(field, output);
+        field_codec<Field>::decode(input, decoded);
+    };
+}
+
+namespace pi::tl
+{
+    template <typename Field>
+    requires std::is_trivially_copyable_v<Field>
+    struct field_codec<Field>
+    {
+        [[nodiscard]] size_t static constexpr size(Field const &) noexcept
+        {
+            return sizeof(Field);
+        }
+
+        void static encode(Field const &field, std::span<std::byte> const bytes) noexcept
+        {
+            std::memcpy(bytes.data(), std::addressof(field), sizeof(Field));
+        }
+
+        void static decode(std::span<std::byte const> const bytes, Field &field)
+        {
+            if (bytes.size() != sizeof(Field))
+                throw std::invalid_argument("An encoded field does not have the size of the field with the same key.");
+
+            std::memcpy(static_cast<void *>(std::addressof(field)), bytes.data(), sizeof(Field));
+        }
+    };
+
+    template <internal::bytewise_container Field>
+    struct field_codec<Field>
+    {
+        using value_type = std::ranges::range_value_t<Field>;
+
+        [[nodiscard]] size_t static size(Field const &field) noexcept
+        {
+            return std::ranges::size(field) * sizeof(value_type);
+        }
+
+        void static encode(Field const &field, std::span<std::byte> const bytes) noexcept
+        {
+            if (!bytes.empty())
+                std::memcpy(bytes.data(), std::ranges::data(field), bytes.size());
+        }
+
+        void static decode(std::span<std::byte const> const bytes, Field &field)
+        {
+            if (bytes.size() % sizeof(value_type) != 0U)
+                throw std::invalid_argument("An encoded field is not a whole number of elements of the field with the same key.");
+
+            field.resize(bytes.size() / sizeof(value_type));
+            if (!bytes.empty())
+                std::memcpy(static_cast<void *>(std::ranges::data(field)), bytes.data(), bytes.size());
+        }
+    };
+}
+
+namespace pi::tl::internal
+{
+    /*! The fields of a record: those of a struct, or the record itself (e.g. a typedecl). */
+    template <typename Record>
+    struct record_traits
+    {
+        using fields_t = typelist<Record>;
+
+        template <typename Self, typename Visitor>
+        void static for_each_field(Self &record, Visitor &&visitor)
+        {
+            visitor(std::integral_constant<size_t, 0>{}, record);
+        }
+    };
+
+    template <layout Layout, typename ...TypeList>
+    struct record_traits<basic_struct_t<Layout, TypeList...>>
+    {
+        using fields_t = typelist<TypeList...>;
+
+        template <typename Self, typename Visitor>
+        void static for_each_field(Self &record, Visitor &&visitor)
+        {
+            record.for_each_field(std::forward<Visitor>(visitor));
+        }
+    };
+
+    template <typename ...Fields>
+    bool consteval are_bitwise_copyable(typelist<Fields...>)
+    {
+        return (std::is_trivially_copyable_v<Fields> && ...);
+    }
+
+    template <typename ...Fields>
+    bool consteval have_field_codecs(typelist<Fields...>)
+    {
+        return (has_field_codec<Fields> && ...);
+    }
+
+    /*! The key of each field: the hash of its type ID and of its rank among the fields of the same type. */
+    template <typename ...Fields, size_t ...Indices>
+    [[nodiscard]] auto consteval make_field_keys(typelist<Fields...>, std::index_sequence<Indices...>)
+    {
+        return std::array<uint64_t, sizeof...(Fields)>{ fnv1a(rank_of<Fields, Indices, Fields...>(), td::type_id_v<Fields>)... };
+    }
+
+    template <typename Record>
+    using fields_t = typename record_traits<Record>::fields_t;
+
+    template <typename Record>
+    auto constexpr field_keys = make_field_keys(fields_t<Record>{}, std::make_index_sequence<fields_t<Record>::size>{});
+
+    template <typename ...Fields>
+    size_t consteval tagged_size(typelist<Fields...>)
+    {
+        return sizeof(uint32_t) + ((sizeof(uint64_t) + sizeof(uint32_t) + sizeof(Fields)) + ... + size_t{ 0 });
+    }
+
+    /*! The number of bytes encode_tagged writes for the record. */
+    template <typename Record>
+    [[nodiscard]] size_t tagged_record_size(Record const &record)
+    {
+        auto size = sizeof(uint32_t);
+        record_traits<Record>::for_each_field(record, [&size](auto, auto const &field)
+        {
+            auto const field_size = field_codec<std::remove_cvref_t<decltype(field)>>::size(field);
+            if (field_size > std::numeric_limits<uint32_t>::max())
+                throw std::length_error("A field is too large for the tagged encoding, which writes its size on 32 bits.");
+
+            size += sizeof(uint64_t) + sizeof(uint32_t) + field_size;
+        });
+
+        return size;
+    }
+
+    size_t inline constexpr header_size = 2U * sizeof(uint64_t) + 2U * sizeof(uint32_t);
+
+    struct header
+    {
+        uint64_t schema;
+        uint32_t format;
+        uint32_t padding;
+        uint64_t count;
+    };
+
+    /*! Writes at the start of the buffer and moves past what it wrote; the caller checks the size of the buffer. */
+    struct writer
+    {
+        std::byte *position;
+
+        void bytes(void const *const source, size_t const size) noexcept
+        {
+            std::memcpy(position, source, size);
+            position += size;
+        }
+
+        template <typename Type>
+        void value(Type const value) noexcept
+        {
+            bytes(&value, sizeof(Type));
+        }
+
+        /*! The next size bytes, for the caller to write. */
+        std::span<std::byte> reserve(size_t const size) noexcept
+        {
+            auto const reserved = std::span<std::byte>{ position, size };
+            position += size;
+            return reserved;
+        }
+    };
+
+    /*! Reads from the start of the buffer and moves past what it read. */
+    struct reader
+    {
+        std::span<std::byte const> buffer;
+
+        std::span<std::byte const> bytes(size_t const size)
+        {
+            if (size > buffer.size())
+                throw std::length_error("The buffer ends in the middle of a record.");
+
+            auto const read = buffer.first(size);
+            buffer = buffer.subspan(size);
+            return read;
+        }
+
+        template <typename Type>
+        Type value()
+        {
+            auto result = Type{};
+            std::memcpy(&result, bytes(sizeof(Type)).data(), sizeof(Type));
+            return result;
+        }
+    };
+
+    template <typename Record>
+    void encode_tagged(Record const &record, writer &output)
+    {
+        output.value(static_cast<uint32_t>(fields_t<Record>::size));
+        record_traits<Record>::for_each_field(record, [&output]<size_t Index>(std::integral_constant<size_t, Index>, auto const &field)
+        {
+            using codec_t = field_codec<std::remove_cvref_t<decltype(field)>>;
+
+            auto const size = codec_t::size(field);
+            output.value(field_keys<Record>[Index]);
+            output.value(static_cast<uint32_t>(size));
+            codec_t::encode(field, output.reserve(size));
+        });
+    }
+
+    template <typename Record>
+    void decode_tagged(reader &input, Record &record)
+    {
+        auto const count = input.value<uint32_t>();
+        auto entries = reader{ input.buffer };
+        for (auto entry = uint32_t{ 0 }; entry < count; ++entry)
+        {
+            input.value<uint64_t>();
+            input.bytes(input.value<uint32_t>());
+        }
+        entries.buffer = entries.buffer.first(entries.buffer.size() - input.buffer.size());
+
+        record = Record{};
+        record_traits<Record>::for_each_field(record, [&entries]<size_t Index>(std::integral_constant<size_t, Index>, auto &field)
+        {
+            for (auto search = entries; !search.buffer.empty();)
+            {
+                auto const key = search.value<uint64_t>();
+                auto const value = search.bytes(search.value<uint32_t>());
+                if (key != field_keys<Record>[Index])
+                    continue;
+
+                field_codec<std::remove_cvref_t<decltype(field)>>::decode(value, field);
+                return;
+            }
+        });
+    }
+}
+
+namespace pi::tl
+{
+    /*!
+     * @brief The hash of the type ID of Record (its fields, their tags and their layout), its size and its alignment.
+     * @note The schema, and the keys of the tagged fields, are the same with every compiler when the tags are tag<"name">
+     *       (see td::type_id).
+     */
+    template <typename Record>
+    uint64_t constexpr schema_hash_v = internal::fnv1a(alignof(Record), internal::fnv1a(sizeof(Record), td::type_id_v<Record>));
+
+    /*! Whether a Record can be encoded with the raw encoding: all its fields (a struct's, or the record itself) are trivially copyable. */
+    template <typename Record>
+    bool constexpr is_raw_encodable_v = internal::are_bitwise_copyable(internal::fields_t<Record>{});
+
+    /*! Whether a Record can be encoded with the tagged encoding: all its fields have a field_codec. */
+    template <typename Record>
+    bool constexpr is_encodable_v = internal::have_field_codecs(internal::fields_t<Record>{});
+
+    /*! The number of bytes encode writes for count records, whose fields are trivially copyable. */
+    template <typename Record>
+    [[nodiscard]] size_t constexpr encoded_size(size_t const count, encoding const format = encoding::raw) noexcept
+    {
+        static_assert(is_raw_encodable_v<Record>, "The encoded size of records with fields of variable size depends on their values: see encoded_size(records, format).");
+
+        auto const record_size = format == encoding::raw ? sizeof(Record) : internal::tagged_size(internal::fields_t<Record>{});
+        return internal::header_size + count * record_size;
+    }
+
+    /*!
+     * @brief The number of bytes encode writes for the records, a contiguous range.
+     * @throws std::invalid_argument if the format is raw and the fields of the records are not all trivially copyable.
+     * @throws std::length_error if a field is too large for the tagged encoding.
+     */
+    template <std::ranges::contiguous_range Records>
+    [[nodiscard]] size_t encoded_size(Records const &records, encoding const format = encoding::raw)
+    {
+        using Record = std::ranges::range_value_t<Records>;
+        if constexpr (is_raw_encodable_v<Record>)
+            return encoded_size<Record>(std::ranges::size(records), format);
+        else
+        {
+            if (format == encoding::raw)
+                throw std::invalid_argument("The raw encoding needs records whose fields are all trivially copyable; use the tagged one.");
+
+            auto size = internal::header_size;
+            for (auto const &record : records)
+                size += internal::tagged_record_size(record);
+
+            return size;
+        }
+    }
+
+    /*!
+     * @brief Encodes the records, a contiguous range, into the buffer, without allocating.
+     * The raw encoding copies all the records with a single memcpy; the tagged one encodes each field with its field_codec.
+     * @returns The number of bytes written, encoded_size(records, format).
+     * @throws std::length_error if the buffer is too small; nothing is written then.
+     * @throws std::invalid_argument if the format is raw and the fields of the records are not all trivially copyable.
+     */
+    template <std::ranges::contiguous_range Records>
+    size_t encode(Records const &records, std::span<std::byte> const buffer, encoding const format = encoding::raw)
+    {
+        using Record = std::ranges::range_value_t<Records>;
+        static_assert(is_encodable_v<Record>, "The fields of an encoded record must have a field_codec: trivially copyable, a resizable contiguous container of trivially copyable values, or specialized.");
+
+        auto const size = encoded_size(records, format);
+        if (size > buffer.size())
+            throw std::length_error("The buffer is too small for the encoded records.");
+
+        auto output = internal::writer{ buffer.data() };
+        output.value(schema_hash_v<Record>);
+        output.value(static_cast<uint32_t>(format));
+        output.value(uint32_t{ 0 });
+        output.value(static_cast<uint64_t>(std::ranges::size(records)));
+
+        if constexpr (is_raw_encodable_v<Record>)
+        {
+            if (format == encoding::raw)
+            {
+                output.bytes(static_cast<void const *>(std::ranges::data(records)), std::ranges::size(records) * sizeof(Record));
+                return size;
+            }
+        }
+
+        for (auto const &record : records)
+            internal::encode_tagged(record, output);
+
+        return size;
+    }
+
+    /*! Encodes one record into the buffer, without allocating. */
+    template <typename Record>
+    requires (!std::ranges::contiguous_range<Record>)
+    size_t encode(Record const &record, std::span<std::byte> const buffer, encoding const format = encoding::raw)
+    {
+        return encode(std::span<Record const>{ std::addressof(record), 1U }, buffer, format);
+    }
+
+    /*!
+     * @brief Decodes the records of the buffer into the first ones of records, a contiguous range.
+     * Raw records are copied with a single memcpy. Tagged records are value-initialized, then each of their fields is
+     * decoded by its field_codec from the encoded field with the same key, if any; the encoded fields without a matching
+     * field are skipped.
+     * @returns The number of records decoded.
+     * @throws std::length_error if the buffer is truncated or if records is too small.
+     * @throws std::invalid_argument if the buffer holds raw records of another schema, or is not an encoding.
+     */
+    template <std::ranges::contiguous_range Records>
+    size_t decode(std::span<std::byte const> const buffer, Records &&records)
+    {
+        using Record = std::ranges::range_value_t<Records>;
+        static_assert(is_encodable_v<Record>, "The fields of a decoded record must have a field_codec: trivially copyable, a resizable contiguous container of trivially copyable values, or specialized.");
+
+        auto input = internal::reader{ buffer };
+        auto const header = internal::header{ input.value<uint64_t>(), input.value<uint32_t>(), input.value<uint32_t>(), input.value<uint64_t>() };
+        if (header.padding != 0U)
+            throw std::invalid_argument("The buffer does not start with the header of an encoding.");
+
+        if (header.count > std::ranges::size(records))
+            throw std::length_error("There are more encoded records than records to decode them into.");
+
+        if (header.format == static_cast<uint32_t>(encoding::raw))
+        {
+            if (header.schema != schema_hash_v<Record>)
+                throw std::invalid_argument("The raw records were encoded with another schema; only tagged records can be.");
+
+            if constexpr (is_raw_encodable_v<Record>)
+            {
+                auto const bytes = input.bytes(header.count * sizeof(Record));
+                std::memcpy(static_cast<void *>(std::ranges::data(records)), bytes.data(), bytes.size());
+            }
+            else
+                throw std::invalid_argument("The raw encoding needs records whose fields are all trivially copyable; use the tagged one.");
+        }
+        else if (header.format == static_cast<uint32_t>(encoding::tagged))
+        {
+            for (auto &record : std::span{ std::ranges::data(records), header.count })
+                internal::decode_tagged(input, record);
+        }
+        else
+            throw std::invalid_argument("The buffer does not start with the header of an encoding.");
+
+        return header.count;
+    }
+
+    /*! Decodes the single record of the buffer; see decode(buffer, records). */
+    template <typename Record>
+    [[nodiscard]] Record decode(std::span<std::byte const> const buffer)
+    {
+        auto record = Record{};
+        if (decode(buffer, std::span<Record>{ std::addressof(record), 1U }) != 1U)
+            throw std::invalid_argument("The buffer does not hold a record.");
+
+        return record;
+    }
+}
+
+#endif //PITYPELISTS_CODEC_HXX
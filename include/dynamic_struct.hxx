@@ -0,0 +1,413 @@
+#ifndef PITYPELISTS_DYNAMIC_STRUCT_HXX
+#define PITYPELISTS_DYNAMIC_STRUCT_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <struct.hxx>
+#include <typedecl.hxx>
+
+namespace pi::tl::internal
+{
+    /*! One entry of a dynamic_struct: the ID of the field's type, how to copy and destroy it, and the field itself. */
+    struct dynamic_slot
+    {
+        size_t static constexpr inline_size = 2U * sizeof(void *);
+        size_t static constexpr inline_alignment = alignof(std::max_align_t);
+
+        struct operations
+        {
+            void (*copy)(std::byte *destination, std::byte const *source); // nullptr when the field cannot be copied
+            void (*destroy)(std::byte *storage) noexcept;
+        };
+
+        /*! Trivially copyable fields that fit in storage are stored in it; the others are allocated and pointed to from it. */
+        template <typename Type>
+        bool static constexpr is_inline = std::is_trivially_copyable_v<Type> && sizeof(Type) <= inline_size && alignof(Type) <= inline_alignment;
+
+        template <typename Type>
+        [[nodiscard]] Type *field() noexcept
+        {
+            if constexpr (is_inline<Type>)
+                return std::launder(reinterpret_cast<Type *>(storage));
+            else
+                return *std::launder(reinterpret_cast<Type **>(storage));
+        }
+
+        template <typename Type, typename ...Arguments>
+        void construct(Arguments &&...arguments)
+        {
+            if constexpr (is_inline<Type>)
+                ::new (static_cast<void *>(storage)) Type(std::forward<Arguments>(arguments)...);
+            else
+                ::new (static_cast<void *>(storage)) Type *(new Type(std::forward<Arguments>(arguments)...));
+
+            id = td::type_id_v<Type>;
+            ops = &operations_of<Type>;
+        }
+
+        template <typename Type>
+        static void copy(std::byte *const destination, std::byte const *const source)
+        {
+            if constexpr (is_inline<Type>)
+                std::memcpy(destination, source, sizeof(Type));
+            else
+                ::new (static_cast<void *>(destination)) Type *(new Type(**std::launder(reinterpret_cast<Type * const *>(source))));
+        }
+
+        template <typename Type>
+        [[nodiscard]] auto static consteval copy_of() -> decltype(operations::copy)
+        {
+            if constexpr (std::is_copy_constructible_v<Type>)
+                return &copy<Type>;
+            else
+                return nullptr;
+        }
+
+        template <typename Type>
+        static constexpr operations operations_of
+        {
+            copy_of<Type>(),
+            [](std::byte *const storage) noexcept
+            {
+                if constexpr (!is_inline<Type>)
+                    delete *std::launder(reinterpret_cast<Type **>(storage));
+            }
+        };
+
+        uint64_t id;
+        operations const *ops; // nullptr when the slot is empty
+        alignas(inline_alignment) std::byte storage[inline_size];
+    };
+}
+
+namespace pi::tl
+{
+    /*!
+     * @brief A struct whose fields are only known at run time, looked up by type like those of a struct_t.
+     * The fields are stored in a flat, open-addressed table (linear probing) keyed by their td::type_id_v: looking one up
+     * hashes nothing at run time and probes a few adjacent slots. Small trivially copyable fields are stored in their
+     * slot; the others are allocated on their own.
+     * @note Fields are identified by their type ID: typedecls that differ only by their policies are the same field.
+     * @note The types of the fields are only known at run time, so a dynamic_struct is always copyable: copying one that
+     *       holds a field that cannot be copied (e.g. a std::unique_ptr) throws std::invalid_argument, and leaves the
+     *       destination of an assignment unchanged. Move such a struct instead.
+     */
+    class dynamic_struct
+    {
+    public:
+        dynamic_struct() noexcept = default;
+
+        /*! Holds a copy of each field of record. */
+        template <layout Layout, typename ...Fields>
+        explicit dynamic_struct(basic_struct_t<Layout, Fields...> const &record)
+        {
+            static_assert(has_distinct_ids<Fields...>(), "The fields of the struct must have distinct type IDs.");
+
+            reserve(sizeof...(Fields));
+            record.for_each_field([this](auto, auto const &field)
+            {
+                set(field);
+            });
+        }
+
+        /*! @throws std::invalid_argument if a field of other cannot be copied (e.g. a std::unique_ptr). */
+        dynamic_struct(dynamic_struct const &other)
+            : slots_{ other.capacity_ > 0U ? std::make_unique<internal::dynamic_slot[]>(other.capacity_) : nullptr }
+            , capacity_{ other.capacity_ }
+        {
+            try
+            {
+                for (auto index = size_t{ 0 }; index < capacity_; ++index)
+                    if (auto const &slot = other.slots_[index]; slot.ops != nullptr)
+                    {
+                        if (slot.ops->copy == nullptr)
+                            throw std::invalid_argument("The struct has a field that cannot be copied.");
+
+                        slot.ops->copy(slots_[index].storage, slot.storage);
+                        slots_[index].id = slot.id;
+                        slots_[index].ops = slot.ops;
+                        ++size_;
+                    }
+            }
+            catch (...)
+            {
+                clear();
+                throw;
+            }
+        }
+
+        dynamic_struct(dynamic_struct &&other) noexcept
+            : slots_{ std::move(other.slots_) }
+            , capacity_{ std::exchange(other.capacity_, 0U) }
+            , size_{ std::exchange(other.size_, 0U) }
+        {
+        }
+
+        dynamic_struct &operator =(dynamic_struct const &other)
+        {
+            if (this != &other)
+                *this = dynamic_struct{ other };
+
+            return *this;
+        }
+
+        dynamic_struct &operator =(dynamic_struct &&other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+                slots_ = std::move(other.slots_);
+                capacity_ = std::exchange(other.capacity_, 0U);
+                size_ = std::exchange(other.size_, 0U);
+            }
+
+            return *this;
+        }
+
+        ~dynamic_struct()
+        {
+            clear();
+        }
+
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size_ == 0U;
+        }
+
+        template <typename Type>
+        [[nodiscard]] bool contains() const noexcept
+        {
+            return find_slot(td::type_id_v<Type>) != nullptr;
+        }
+
+        /*! The field of type Type, or nullptr if there is none. */
+        template <typename Type>
+        [[nodiscard]] Type *find() noexcept
+        {
+            auto *const slot = find_slot(td::type_id_v<Type>);
+            return slot != nullptr ? slot->template field<Type>() : nullptr;
+        }
+
+        template <typename Type>
+        [[nodiscard]] Type const *find() const noexcept
+        {
+            return const_cast<dynamic_struct *>(this)->find<Type>();
+        }
+
+        /*!
+         * @returns The field of type Type.
+         * @throws std::out_of_range if there is no field of type Type.
+         */
+        template <typename Type>
+        [[nodiscard]] Type &get()
+        {
+            if (auto *const field = find<Type>(); field != nullptr)
+                return *field;
+
+            throw std::out_of_range("The struct has no field of that type.");
+        }
+
+        template <typename Type>
+        [[nodiscard]] Type const &get() const
+        {
+            return const_cast<dynamic_struct *>(this)->get<Type>();
+        }
+
+        /*! Assigns value to the field of its type, adding the field if there is none. */
+        template <typename Type>
+        std::decay_t<Type> &set(Type &&value)
+        {
+            using field_t = std::decay_t<Type>;
+            if (auto *const field = find<field_t>(); field != nullptr)
+            {
+                *field = std::forward<Type>(value);
+                return *field;
+            }
+
+            return emplace<field_t>(std::forward<Type>(value));
+        }
+
+        /*!
+         * @brief Constructs a field of type Type from the arguments, replacing the field of that type if there is one.
+         * The field is constructed before the one it replaces is destroyed, so the arguments may refer to it
+         * (ds.emplace<T>(ds.get<T>())), and if the construction or the allocation throws the struct is left unchanged.
+         * @returns The new field.
+         */
+        template <typename Type, typename ...Arguments>
+        Type &emplace(Arguments &&...arguments)
+        {
+            static_assert(std::is_same_v<Type, std::decay_t<Type>>, "The fields of a dynamic struct cannot be constant nor references.");
+
+            auto constructed = internal::dynamic_slot{};
+            constructed.template construct<Type>(std::forward<Arguments>(arguments)...);
+
+            auto *slot = find_slot(constructed.id);
+            if (slot != nullptr)
+                slot->ops->destroy(slot->storage);
+            else
+            {
+                try
+                {
+                    reserve(size_ + 1U);
+                }
+                catch (...)
+                {
+                    constructed.ops->destroy(constructed.storage);
+                    throw;
+                }
+
+                slot = &slots_[free_index(constructed.id)];
+                ++size_;
+            }
+
+            std::memcpy(static_cast<void *>(slot), &constructed, sizeof(internal::dynamic_slot));
+            return *slot->template field<Type>();
+        }
+
+        /*! Removes the field of type Type, if there is one. @returns Whether there was one. */
+        template <typename Type>
+        bool erase() noexcept
+        {
+            auto *const slot = find_slot(td::type_id_v<Type>);
+            if (slot == nullptr)
+                return false;
+
+            slot->ops->destroy(slot->storage);
+            close_hole(static_cast<size_t>(slot - slots_.get()));
+            --size_;
+            return true;
+        }
+
+        void clear() noexcept
+        {
+            for (auto index = size_t{ 0 }; index < capacity_; ++index)
+                if (auto &slot = slots_[index]; slot.ops != nullptr)
+                {
+                    slot.ops->destroy(slot.storage);
+                    slot.ops = nullptr;
+                }
+
+            size_ = 0U;
+        }
+
+        /*! Makes room for count fields, so that adding them does not rehash. */
+        void reserve(size_t const count)
+        {
+            auto capacity = capacity_ > 0U ? capacity_ : minimum_capacity;
+            while (count * max_load_denominator > capacity * max_load_numerator)
+                capacity *= 2U;
+
+            if (capacity != capacity_)
+                rehash(capacity);
+        }
+
+        /*!
+         * @brief A copy of the fields, as a Struct (e.g. a struct_t) with the same set of fields.
+         * @throws std::invalid_argument if the fields are not the ones of Struct.
+         */
+        template <typename Struct>
+        [[nodiscard]] Struct as() const
+        {
+            return as(std::type_identity<Struct>{});
+        }
+
+    private:
+        size_t static constexpr minimum_capacity = 8U;
+        size_t static constexpr max_load_numerator = 3U;
+        size_t static constexpr max_load_denominator = 4U;
+
+        template <typename ...Fields>
+        [[nodiscard]] bool static consteval has_distinct_ids()
+        {
+            uint64_t const ids[] = { td::type_id_v<Fields>..., 0U };
+            for (auto left = size_t{ 0 }; left < sizeof...(Fields); ++left)
+                for (auto right = left + 1U; right < sizeof...(Fields); ++right)
+                    if (ids[left] == ids[right])
+                        return false;
+
+            return true;
+        }
+
+        template <layout Layout, typename ...Fields>
+        [[nodiscard]] basic_struct_t<Layout, Fields...> as(std::type_identity<basic_struct_t<Layout, Fields...>>) const
+        {
+            static_assert(has_distinct_ids<Fields...>(), "The fields of the struct must have distinct type IDs.");
+
+            if (size_ != sizeof...(Fields) || !(contains<Fields>() && ...))
+                throw std::invalid_argument("The fields of the dynamic struct are not the ones of the struct.");
+
+            return basic_struct_t<Layout, Fields...>{ get<Fields>()... };
+        }
+
+        [[nodiscard]] size_t home_of(uint64_t const id) const noexcept
+        {
+            return static_cast<size_t>(id) & (capacity_ - 1U);
+        }
+
+        [[nodiscard]] internal::dynamic_slot *find_slot(uint64_t const id) const noexcept
+        {
+            if (size_ == 0U)
+                return nullptr;
+
+            for (auto index = home_of(id);; index = (index + 1U) & (capacity_ - 1U))
+            {
+                auto &slot = slots_[index];
+                if (slot.ops == nullptr)
+                    return nullptr;
+                if (slot.id == id)
+                    return &slot;
+            }
+        }
+
+        [[nodiscard]] size_t free_index(uint64_t const id) const noexcept
+        {
+            auto index = home_of(id);
+            while (slots_[index].ops != nullptr)
+                index = (index + 1U) & (capacity_ - 1U);
+
+            return index;
+        }
+
+        /*! Moves back the following slots of the probe sequence into the emptied one, so that lookups need no tombstone. */
+        void close_hole(size_t hole) noexcept
+        {
+            auto const mask = capacity_ - 1U;
+            for (auto next = (hole + 1U) & mask; slots_[next].ops != nullptr; next = (next + 1U) & mask)
+                if (((next - home_of(slots_[next].id)) & mask) >= ((next - hole) & mask))
+                {
+                    std::memcpy(static_cast<void *>(&slots_[hole]), &slots_[next], sizeof(internal::dynamic_slot));
+                    hole = next;
+                }
+
+            slots_[hole].ops = nullptr;
+        }
+
+        /*! The slots hold trivially copyable fields or pointers: they are moved to the new table by copying their bytes. */
+        void rehash(size_t const capacity)
+        {
+            auto previous = std::exchange(slots_, std::make_unique<internal::dynamic_slot[]>(capacity));
+            auto const previous_capacity = std::exchange(capacity_, capacity);
+            for (auto index = size_t{ 0 }; index < previous_capacity; ++index)
+                if (auto const &slot = previous[index]; slot.ops != nullptr)
+                    std::memcpy(static_cast<void *>(&slots_[free_index(slot.id)]), &slot, sizeof(internal::dynamic_slot));
+        }
+
+        std::unique_ptr<internal::dynamic_slot[]> slots_;
+        size_t capacity_{ 0U };
+        size_t size_{ 0U };
+    };
+}
+
+#endif //PITYPELISTS_DYNAMIC_STRUCT_HXX
@@ -0,0 +1,218 @@
+#ifndef PITYPELISTS_SIMD_HXX
+#define PITYPELISTS_SIMD_HXX
+
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+
+#include <td_simd.hxx>
+#include <typedecl.hxx>
+
+namespace pi::td::simd
+{
+    template <typename Type>
+    struct is_fundamental_typedecl : std::false_type {};
+
+    template <typename Type, typename Tag, typename ...Policies>
+    struct is_fundamental_typedecl<typedecl<Type, Tag, Policies...>> : std::is_arithmetic<Type> {};
+
+    /*! A contiguous range of typedecls of an arithmetic type, such as a std::vector, a std::span or a struct_vector column. */
+    template <typename Range>
+    concept column = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>
+                  && is_fundamental_typedecl<std::ranges::range_value_t<Range>>::value;
+
+    /*! A column that can be written to. */
+    template <typename Range>
+    concept output_column = column<Range> && !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>;
+
+    /*! Columns of the same strong type: x_t values can only be combined with x_t values. */
+    template <typename Range, typename ...Ranges>
+    concept same_strong_type = (std::is_same_v<std::ranges::range_value_t<Range>, std::ranges::range_value_t<Ranges>> && ...);
+
+    /*!
+     * @brief Element-wise output[i] = left[i] + right[i].
+     * @note All the columns must have the same strong type and the same size; output may be one of the inputs.
+     * @throws std::invalid_argument if the columns do not have the same size.
+     */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void add(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = left[i] - right[i]; see add. */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void subtract(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = left[i] * right[i]; see add. */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void multiply(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = left[i] / right[i]; see add. */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void divide(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = left[i] * right[i] + addend[i], with a single rounding where the target has FMA; see add. */
+    template <column Left, column Right, column Addend, output_column Output>
+    requires same_strong_type<Output, Left, Right, Addend>
+    void fma(Left const &left, Right const &right, Addend const &addend, Output &&output);
+
+    /*! Element-wise output[i] = left[i] < right[i] ? left[i] : right[i]; see add. */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void min(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = left[i] > right[i] ? left[i] : right[i]; see add. */
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void max(Left const &left, Right const &right, Output &&output);
+
+    /*! Element-wise output[i] = min(max(values[i], low), high), with low and high of the same strong type; see add. */
+    template <column Values, output_column Output>
+    requires same_strong_type<Output, Values>
+    void clamp(Values const &values, std::ranges::range_value_t<Values> low, std::ranges::range_value_t<Values> high, Output &&output);
+
+    /*!
+     * @brief The sum of the values, of the same strong type as the values; zero for an empty column.
+     * @note The vector implementation adds the values in a different order than a sequential loop, so for floating point
+     *       types the result may differ from it in the last bits.
+     */
+    template <column Values>
+    [[nodiscard]] auto sum(Values const &values);
+
+    /*!
+     * @brief The smallest of the values.
+     * @throws std::invalid_argument if the column is empty.
+     */
+    template <column Values>
+    [[nodiscard]] auto minimum(Values const &values);
+
+    /*!
+     * @brief The largest of the values.
+     * @throws std::invalid_argument if the column is empty.
+     */
+    template <column Values>
+    [[nodiscard]] auto maximum(Values const &values);
+}
+
+namespace pi::td::simd::internal
+{
+    template <typename Range>
+    using strong_t = std::ranges::range_value_t<Range>;
+
+    template <typename Range>
+    using raw_t = typename strong_t<Range>::value_type;
+
+    template <typename Range>
+    [[nodiscard]] auto raw_data(Range &&range) noexcept
+    {
+        using strong_type = strong_t<Range>;
+        static_assert(sizeof(strong_type) == sizeof(raw_t<Range>) && alignof(strong_type) == alignof(raw_t<Range>)
+                      && std::is_standard_layout_v<strong_type>, "A typedecl of a fundamental type must have the layout of that type.");
+
+        using raw_type = std::conditional_t<std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<Range>>>, raw_t<Range> const, raw_t<Range>>;
+        return reinterpret_cast<raw_type *>(std::ranges::data(range)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    template <typename Output, typename Operation, typename ...Inputs>
+    auto transform(Output &&output, Operation const &operation, Inputs const &...inputs)
+    {
+        if (((std::ranges::size(inputs) != std::ranges::size(output)) || ...))
+            throw std::invalid_argument("The columns must have the same size.");
+
+        td::internal::transform(std::ranges::size(output), raw_data(output), operation, raw_data(inputs)...);
+    }
+}
+
+namespace pi::td::simd
+{
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void add(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::add_operation{}, left, right);
+    }
+
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void subtract(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::subtract_operation{}, left, right);
+    }
+
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void multiply(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::multiply_operation{}, left, right);
+    }
+
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void divide(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::divide_operation{}, left, right);
+    }
+
+    template <column Left, column Right, column Addend, output_column Output>
+    requires same_strong_type<Output, Left, Right, Addend>
+    void fma(Left const &left, Right const &right, Addend const &addend, Output &&output)
+    {
+        internal::transform(output, td::internal::fma_operation{}, left, right, addend);
+    }
+
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void min(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::min_operation{}, left, right);
+    }
+
+    template <column Left, column Right, output_column Output>
+    requires same_strong_type<Output, Left, Right>
+    void max(Left const &left, Right const &right, Output &&output)
+    {
+        internal::transform(output, td::internal::max_operation{}, left, right);
+    }
+
+    template <column Values, output_column Output>
+    requires same_strong_type<Output, Values>
+    void clamp(Values const &values, std::ranges::range_value_t<Values> const low, std::ranges::range_value_t<Values> const high, Output &&output)
+    {
+        using raw_type = internal::raw_t<Values>;
+        internal::transform(output, td::internal::clamp_operation<raw_type>{ static_cast<raw_type>(low), static_cast<raw_type>(high) }, values);
+    }
+
+    template <column Values>
+    [[nodiscard]] auto sum(Values const &values)
+    {
+        using strong_type = internal::strong_t<Values>;
+        using raw_type = internal::raw_t<Values>;
+        return strong_type{ td::internal::reduce(std::ranges::size(values), internal::raw_data(values), raw_type{ 0 }, td::internal::add_operation{}) };
+    }
+
+    template <column Values>
+    [[nodiscard]] auto minimum(Values const &values)
+    {
+        if (std::ranges::empty(values))
+            throw std::invalid_argument("The minimum of an empty column is undefined.");
+
+        auto const *const data = internal::raw_data(values);
+        return internal::strong_t<Values>{ td::internal::reduce(std::ranges::size(values), data, data[0], td::internal::min_operation{}) };
+    }
+
+    template <column Values>
+    [[nodiscard]] auto maximum(Values const &values)
+    {
+        if (std::ranges::empty(values))
+            throw std::invalid_argument("The maximum of an empty column is undefined.");
+
+        auto const *const data = internal::raw_data(values);
+        return internal::strong_t<Values>{ td::internal::reduce(std::ranges::size(values), data, data[0], td::internal::max_operation{}) };
+    }
+}
+
+#endif //PITYPELISTS_SIMD_HXX
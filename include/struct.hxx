@@ -1,60 +1,364 @@
 #ifndef PITYPELISTS_STRUCT_HXX
 #define PITYPELISTS_STRUCT_HXX
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <tl_field_initializer.hxx>
+#include <tl_layout.hxx>
+#include <tl_type_name.hxx>
 #include <typedecl.hxx>
 #include <typelists.hxx>
 
 namespace pi::tl
 {
-    template <typename ...TypeList>
-    struct struct_t
+    /*!
+     * @brief A struct whose fields are looked up by type.
+     * @tparam Layout The order in which the fields are stored; it does not change how they are looked up
+     * @tparam TypeList The types of the fields
+     */
+    template <layout Layout, typename ...TypeList>
+    struct basic_struct_t
     {
+        /*! Value-initializes each field. */
+        constexpr basic_struct_t() = default;
+
+        /*!
+         * @brief Constructs each field in place from the argument of the same type (relaxed matching), in any order.
+         * The nth field of a type is constructed from the nth argument of that type; fields without a matching argument
+         * are value-initialized, so only those need to be default constructible.
+         */
+        template <typename ...Arguments>
+        requires (!(sizeof...(Arguments) == 1ULL && (std::is_same_v<std::remove_cvref_t<Arguments>, basic_struct_t> && ...)))
+        constexpr explicit basic_struct_t(Arguments &&...arguments)
+            : basic_struct_t(std::index_sequence_for<TypeList...>{}, std::forward<Arguments>(arguments)...)
+        {
+        }
+
+        /*! Constructs the fields from the arguments, given in the order the fields are declared in (see argument_spec). */
         template <typename ...Arguments>
-        explicit struct_t(Arguments &&...arguments)
+        requires (sizeof...(Arguments) == sizeof...(TypeList))
+        constexpr basic_struct_t(internal::in_declared_order_t, Arguments &&...arguments)
+            : basic_struct_t(internal::in_declared_order, std::index_sequence_for<TypeList...>{}, std::forward<Arguments>(arguments)...)
         {
-            std::apply(  [this](decltype(arguments) ...args) { (set(std::forward<decltype(arguments)>(args)), ...); }
-                       , std::make_tuple(arguments...));
         }
 
         template <typename Type>
         [[nodiscard]] decltype(auto) constexpr get()
         {
-            return std::get<find<Type, TypeList...>()>(data_);
+            return internal::get_field<slot_of<Type>()>(data_);
         }
 
         template <typename Type>
-        auto set(Type &&value)
+        [[nodiscard]] decltype(auto) constexpr get() const
         {
-            std::get<find<Type, TypeList...>()>(data_) = std::forward<Type>(value);
+            return internal::get_field<slot_of<Type>()>(data_);
+        }
+
+        template <typename Type>
+        void constexpr set(Type &&value)
+        {
+            internal::get_field<slot_of<Type>()>(data_) = std::forward<Type>(value);
+        }
+
+        /*! Calls visitor(std::integral_constant<size_t, I>{}, field) for each field, in the order they are declared in. */
+        template <typename Visitor>
+        void constexpr for_each_field(Visitor &&visitor)
+        {
+            for_each_field(data_, visitor, std::index_sequence_for<TypeList...>{});
+        }
+
+        template <typename Visitor>
+        void constexpr for_each_field(Visitor &&visitor) const
+        {
+            for_each_field(data_, visitor, std::index_sequence_for<TypeList...>{});
+        }
+
+        /*! Whether each field equals the field of the same type of other; it makes a struct usable as a key. */
+        [[nodiscard]] friend bool constexpr operator ==(basic_struct_t const &left, basic_struct_t const &right)
+        {
+            return internal::equal_fields(left.data_, right.data_);
         }
 
     private:
-        std::tuple<TypeList...> data_{};
+        template <typename Type>
+        [[nodiscard]] auto static consteval slot_of()
+        {
+            return internal::storage_slots<Layout, TypeList...>[find<Type, TypeList...>()];
+        }
+
+        template <typename Data, typename Visitor, size_t ...Indices>
+        void static constexpr for_each_field(Data &data, Visitor &visitor, std::index_sequence<Indices...>)
+        {
+            (visitor(std::integral_constant<size_t, Indices>{}, internal::get_field<internal::storage_slots<Layout, TypeList...>[Indices]>(data)), ...);
+        }
+
+        template <size_t ...Slots, typename ...Arguments>
+        constexpr explicit basic_struct_t(std::index_sequence<Slots...>, Arguments &&...arguments)
+            : data_{ std::in_place, internal::initializer_for<internal::storage_order<Layout, TypeList...>[Slots]>(typelist<TypeList...>{}, std::forward<Arguments>(arguments)...)... }
+        {
+            static_assert(contains_only<typelist<TypeList...>, Arguments...>(), "Each argument must have the type of a field.");
+        }
+
+        template <size_t ...Slots, typename ...Arguments>
+        constexpr basic_struct_t(internal::in_declared_order_t, std::index_sequence<Slots...>, Arguments &&...arguments)
+            : data_{ std::in_place, pi::tl::get<internal::storage_order<Layout, TypeList...>[Slots], Arguments...>(std::forward<Arguments>(arguments)...)... }
+        {
+        }
+
+        friend struct std::hash<basic_struct_t>;
+
+        internal::storage_t<Layout, TypeList...> data_{};
     };
 
+    /*! A struct whose fields are stored in the order they are declared in. */
+    template <typename ...TypeList>
+    using struct_t = basic_struct_t<layout::declared, TypeList...>;
+
+    /*! A struct whose fields are stored in the order that minimizes the padding between them. */
     template <typename ...TypeList>
-    struct struct_with_consts_t
-        : std::tuple<TypeList...>
+    using packed_struct_t = basic_struct_t<layout::packed, TypeList...>;
+
+    /*!
+     * @brief A struct whose fields are looked up by type and may be constant.
+     * With the declared layout, it derives from std::tuple<TypeList...>: it can be used as that tuple.
+     * @tparam Layout The order in which the fields are stored; it does not change how they are looked up nor the order of
+     *         the constructor's arguments
+     * @tparam TypeList The types of the fields
+     */
+    template <layout Layout, typename ...TypeList>
+    struct basic_struct_with_consts_t
+        : internal::tuple_storage_t<Layout, TypeList...>
     {
+        constexpr basic_struct_with_consts_t() = default;
+
+        /*! Constructs the fields from the arguments, given in the order the fields are declared in. */
         template <typename ...Arguments>
-        explicit struct_with_consts_t(Arguments &&...arguments)
-            : std::tuple<TypeList...>(std::forward<Arguments>(arguments)...)
+        requires (sizeof...(Arguments) == sizeof...(TypeList)
+                  && !(sizeof...(Arguments) == 1ULL && (std::is_same_v<std::remove_cvref_t<Arguments>, basic_struct_with_consts_t> && ...)))
+        constexpr explicit basic_struct_with_consts_t(Arguments &&...arguments)
+            : basic_struct_with_consts_t(std::index_sequence_for<TypeList...>{}, std::forward<Arguments>(arguments)...)
         {
         }
 
         template <typename Type>
         [[nodiscard]] decltype(auto) constexpr get()
         {
-            return std::get<find<Type, TypeList...>()>(*this);
+            return internal::get_field<slot_of<Type>()>(*this);
         }
 
         template <typename Type>
-        auto set(Type &&value)
+        [[nodiscard]] decltype(auto) constexpr get() const
         {
-            if constexpr (std::is_const_v<decltype(tl::get<tl::find<Type, TypeList...>()>(std::forward<TypeList>(TypeList{})...))>)
+            return internal::get_field<slot_of<Type>()>(*this);
+        }
+
+        template <typename Type>
+        void constexpr set(Type &&value)
+        {
+            if constexpr (std::is_const_v<decltype(tl::get<tl::find<Type, TypeList...>(), TypeList...>(std::forward<TypeList>(TypeList{})...))>)
                 throw std::invalid_argument("Trying to change the value of a constant.");
             else
-                std::get<tl::find<Type, TypeList...>()>(*this) = std::forward<Type>(value);
+                internal::get_field<slot_of<Type>()>(*this) = std::forward<Type>(value);
+        }
+
+        [[nodiscard]] friend bool constexpr operator ==(basic_struct_with_consts_t const &left, basic_struct_with_consts_t const &right)
+        {
+            return internal::equal_fields(left, right);
+        }
+
+    private:
+        template <typename Type>
+        [[nodiscard]] auto static consteval slot_of()
+        {
+            return internal::tuple_storage_slots<Layout, TypeList...>[tl::find<Type, TypeList...>()];
+        }
+
+        template <size_t ...Slots, typename ...Arguments>
+        requires (Layout == layout::declared)
+        constexpr explicit basic_struct_with_consts_t(std::index_sequence<Slots...>, Arguments &&...arguments)
+            : std::tuple<TypeList...>(std::forward<Arguments>(arguments)...)
+        {
+        }
+
+        template <size_t ...Slots, typename ...Arguments>
+        requires (Layout != layout::declared)
+        constexpr explicit basic_struct_with_consts_t(std::index_sequence<Slots...>, Arguments &&...arguments)
+            : internal::storage_t<Layout, TypeList...>(std::in_place, pi::tl::get<internal::storage_order<Layout, TypeList...>[Slots], Arguments...>(std::forward<Arguments>(arguments)...)...)
+        {
+        }
+    };
+
+    /*! A struct with constants whose fields are stored in the order they are declared in. */
+    template <typename ...TypeList>
+    using struct_with_consts_t = basic_struct_with_consts_t<layout::declared, TypeList...>;
+
+    /*! A struct with constants whose fields are stored in the order that minimizes the padding between them. */
+    template <typename ...TypeList>
+    using packed_struct_with_consts_t = basic_struct_with_consts_t<layout::packed, TypeList...>;
+
+    /*!
+     * @brief The field at Index in the order the fields are declared in, whatever the layout. With the std::tuple_size
+     * and std::tuple_element specializations below, a struct with constants is tuple-like with every layout: structured
+     * bindings and get<Index>(record), found by argument-dependent lookup.
+     * @note With the declared layout, std::get<Index>(record) and std::apply work as well, on its std::tuple base.
+     */
+    template <size_t Index, layout Layout, typename ...TypeList>
+    [[nodiscard]] auto constexpr get(basic_struct_with_consts_t<Layout, TypeList...> &record) noexcept -> internal::type_at_t<Index, TypeList...> &
+    {
+        return internal::get_field<internal::tuple_storage_slots<Layout, TypeList...>[Index]>(record);
+    }
+
+    template <size_t Index, layout Layout, typename ...TypeList>
+    [[nodiscard]] auto constexpr get(basic_struct_with_consts_t<Layout, TypeList...> const &record) noexcept -> internal::type_at_t<Index, TypeList...> const &
+    {
+        return internal::get_field<internal::tuple_storage_slots<Layout, TypeList...>[Index]>(record);
+    }
+
+    template <size_t Index, layout Layout, typename ...TypeList>
+    [[nodiscard]] auto constexpr get(basic_struct_with_consts_t<Layout, TypeList...> &&record) noexcept -> internal::type_at_t<Index, TypeList...> &&
+    {
+        return std::move(internal::get_field<internal::tuple_storage_slots<Layout, TypeList...>[Index]>(record));
+    }
+
+    template <size_t Index, layout Layout, typename ...TypeList>
+    [[nodiscard]] auto constexpr get(basic_struct_with_consts_t<Layout, TypeList...> const &&record) noexcept -> internal::type_at_t<Index, TypeList...> const &&
+    {
+        return std::move(internal::get_field<internal::tuple_storage_slots<Layout, TypeList...>[Index]>(record));
+    }
+
+    /*! The size of a struct of TypeList, stored in the declared order and packed. */
+    template <typename ...TypeList>
+    struct layout_report
+    {
+        size_t static constexpr declared_size = sizeof(struct_t<TypeList...>);
+        size_t static constexpr packed_size = sizeof(packed_struct_t<TypeList...>);
+        size_t static constexpr saved_bytes = declared_size - packed_size;
+    };
+}
+
+namespace pi::tl::internal
+{
+    /*! Combines the IDs of the fields, and whether they are constant, in the order they are declared in. */
+    template <typename ...TypeList>
+    [[nodiscard]] uint64_t consteval struct_id(std::string_view const kind)
+    {
+        auto id = fnv1a(kind);
+        ((id = fnv1a(td::type_id_v<std::remove_const_t<TypeList>>, fnv1a(std::is_const_v<TypeList> ? 1U : 0U, id))), ...);
+        return id;
+    }
+
+    /*! Whether equal values of Field have the same bytes, and only those: an integer, an enumeration, a pointer or a typedecl of one. */
+    template <typename Field>
+    struct has_unique_bytes : std::bool_constant<std::is_scalar_v<Field> && std::has_unique_object_representations_v<Field>> {};
+
+    template <typename Type, typename Tag, typename ...Policies>
+    struct has_unique_bytes<td::typedecl<Type, Tag, Policies...>>
+        : std::bool_constant<has_unique_bytes<Type>::value && sizeof(td::typedecl<Type, Tag, Policies...>) == sizeof(Type)> {};
+
+    /*!
+     * Whether a Record of TypeList is hashed as a whole, in a single pass over its bytes: each field has unique bytes (not
+     * a floating point, whose -0.0 equals 0.0) and there is no padding between them. std::has_unique_object_representations
+     * is not used on the record itself: GCC rejects the typedecls with operator policies, whose bases are empty.
+     */
+    template <typename Record, typename ...TypeList>
+    bool constexpr is_hashed_as_bytes_v = (has_unique_bytes<std::remove_const_t<TypeList>>::value && ...)
+                                          && (sizeof(TypeList) + ... + 0U) == sizeof(Record);
+
+    /*! Combines the hashes of the fields in the order of their slots. */
+    template <size_t ...Slots, typename ...Fields>
+    [[nodiscard]] size_t hash_fields(storage_base<std::index_sequence<Slots...>, Fields...> const &storage)
+    {
+        auto hash = uint64_t{ sizeof...(Fields) };
+        ((hash = td::internal::combine(hash, std::hash<std::remove_const_t<Fields>>{}(get_field<Slots>(storage)))), ...);
+        return static_cast<size_t>(hash);
+    }
+
+    template <typename ...Fields>
+    [[nodiscard]] size_t hash_fields(std::tuple<Fields...> const &storage)
+    {
+        return std::apply([](auto const &...fields)
+        {
+            auto hash = uint64_t{ sizeof...(Fields) };
+            ((hash = td::internal::combine(hash, std::hash<std::remove_const_t<Fields>>{}(fields))), ...);
+            return static_cast<size_t>(hash);
+        }, storage);
+    }
+
+    template <typename ...TypeList, typename Record, typename Storage>
+    [[nodiscard]] size_t hash_record(Record const &record, Storage const &storage)
+    {
+        if constexpr (is_hashed_as_bytes_v<Record, TypeList...>)
+            return static_cast<size_t>(td::internal::hash_bytes(&record, sizeof(Record)));
+        else
+            return hash_fields(storage);
+    }
+}
+
+namespace pi::td
+{
+    /*! The ID of a struct depends on its kind, its layout and the IDs of its fields, not on how the compiler spells them. */
+    template <tl::layout Layout, typename ...TypeList>
+    struct type_id<tl::basic_struct_t<Layout, TypeList...>>
+    {
+        uint64_t static constexpr value = tl::internal::struct_id<TypeList...>(Layout == tl::layout::packed ? "packed_struct_t" : "struct_t");
+    };
+
+    template <tl::layout Layout, typename ...TypeList>
+    struct type_id<tl::basic_struct_with_consts_t<Layout, TypeList...>>
+    {
+        uint64_t static constexpr value = tl::internal::struct_id<TypeList...>(Layout == tl::layout::packed ? "packed_struct_with_consts_t" : "struct_with_consts_t");
+    };
+
+    /*! A struct is trivially relocatable when all its fields are, whatever the order they are stored in. */
+    template <tl::layout Layout, typename ...TypeList>
+    struct is_trivially_relocatable<tl::basic_struct_t<Layout, TypeList...>> : std::conjunction<is_trivially_relocatable<std::remove_const_t<TypeList>>...> {};
+
+    template <tl::layout Layout, typename ...TypeList>
+    struct is_trivially_relocatable<tl::basic_struct_with_consts_t<Layout, TypeList...>> : std::conjunction<is_trivially_relocatable<std::remove_const_t<TypeList>>...> {};
+}
+
+namespace std
+{
+    /*! The number of fields of a struct with constants, which is tuple-like (see pi::tl::get). */
+    template <pi::tl::layout Layout, typename ...TypeList>
+    struct tuple_size<pi::tl::basic_struct_with_consts_t<Layout, TypeList...>> : integral_constant<size_t, sizeof...(TypeList)> {};
+
+    /*! The type of the field at Index of a struct with constants, in the order the fields are declared in. */
+    template <size_t Index, pi::tl::layout Layout, typename ...TypeList>
+    struct tuple_element<Index, pi::tl::basic_struct_with_consts_t<Layout, TypeList...>>
+    {
+        using type = pi::tl::internal::type_at_t<Index, TypeList...>;
+    };
+
+    /*!
+     * @brief A struct is hashable when all its fields are. When equal structs have the same bytes (fields of scalar
+     * types without padding nor floating points, see is_hashed_as_bytes_v), its bytes are hashed in a single pass;
+     * otherwise the hashes of the fields are combined with td::internal::combine, in the order of their slots.
+     */
+    template <pi::tl::layout Layout, typename ...TypeList>
+    requires (pi::td::internal::is_hashable_v<std::remove_const_t<TypeList>> && ...)
+    struct hash<pi::tl::basic_struct_t<Layout, TypeList...>>
+    {
+        [[nodiscard]] size_t operator ()(pi::tl::basic_struct_t<Layout, TypeList...> const &record) const
+        {
+            return pi::tl::internal::hash_record<TypeList...>(record, record.data_);
+        }
+    };
+
+    template <pi::tl::layout Layout, typename ...TypeList>
+    requires (pi::td::internal::is_hashable_v<std::remove_const_t<TypeList>> && ...)
+    struct hash<pi::tl::basic_struct_with_consts_t<Layout, TypeList...>>
+    {
+        [[nodiscard]] size_t operator ()(pi::tl::basic_struct_with_consts_t<Layout, TypeList...> const &record) const
+        {
+            return pi::tl::internal::hash_record<TypeList...>(record, static_cast<pi::tl::internal::tuple_storage_t<Layout, TypeList...> const &>(record));
         }
     };
 }
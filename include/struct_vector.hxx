@@ -0,0 +1,149 @@
+#ifndef PITYPELISTS_STRUCT_VECTOR_HXX
+#define PITYPELISTS_STRUCT_VECTOR_HXX
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <tl_field_initializer.hxx>
+#include <typedecl.hxx>
+#include <typelists.hxx>
+
+namespace pi::tl
+{
+    /*!
+     * @brief A sequence of records with the fields of struct_t<Fields...>, stored as a structure of arrays: each field
+     *        has its own contiguous column, so a loop over one field only brings that field into the cache.
+     * @tparam Fields The types of the fields; they are looked up by type, like in struct_t
+     */
+    template <typename ...Fields>
+    class struct_vector
+    {
+        static_assert(sizeof...(Fields) > 0U, "A struct_vector must have at least one field.");
+        static_assert(((!std::is_const_v<Fields> && !std::is_reference_v<Fields>) && ...), "The fields of a struct_vector must be neither constant nor references.");
+
+    public:
+        /*! A reference to one record of a struct_vector; Owner is the struct_vector, possibly const. */
+        template <typename Owner>
+        class row_proxy
+        {
+        public:
+            constexpr row_proxy(Owner &owner, size_t const index) noexcept
+                : owner_{ &owner }
+                , index_{ index }
+            {
+            }
+
+            template <typename Type>
+            [[nodiscard]] decltype(auto) constexpr get() const
+            {
+                return owner_->template column<Type>()[index_];
+            }
+
+            template <typename Type>
+            auto set(Type &&value) const
+            {
+                get<Type>() = std::forward<Type>(value);
+            }
+
+        private:
+            Owner *owner_;
+            size_t index_;
+        };
+
+        using row = row_proxy<struct_vector>;
+        using const_row = row_proxy<struct_vector const>;
+
+        [[nodiscard]] auto size() const noexcept
+        {
+            return std::get<0U>(columns_).size();
+        }
+
+        [[nodiscard]] auto empty() const noexcept
+        {
+            return size() == 0U;
+        }
+
+        auto reserve(size_t const capacity)
+        {
+            std::apply([capacity](auto &...columns) { (columns.reserve(capacity), ...); }, columns_);
+        }
+
+        auto clear() noexcept
+        {
+            std::apply([](auto &...columns) { (columns.clear(), ...); }, columns_);
+        }
+
+        /*!
+         * @brief Appends a record whose fields are constructed from the arguments exactly like the fields of struct_t:
+         *        by type, in any order, with the fields without a matching argument value-initialized.
+         * @note If a constructor or an allocation throws, the columns are left as they were (the arguments may have
+         *       been moved from), so that they all keep the same size.
+         */
+        template <typename ...Arguments>
+        auto push_back(Arguments &&...arguments)
+        {
+            static_assert(contains_only<typelist<Fields...>, Arguments...>(), "Each argument must have the type of a field.");
+
+            push_back(std::index_sequence_for<Fields...>{}, std::forward<Arguments>(arguments)...);
+        }
+
+        [[nodiscard]] auto operator [](size_t const index) noexcept
+        {
+            return row{ *this, index };
+        }
+
+        [[nodiscard]] auto operator [](size_t const index) const noexcept
+        {
+            return const_row{ *this, index };
+        }
+
+        /*! The contiguous values of the field of type Type, one per record. */
+        template <typename Type>
+        [[nodiscard]] auto column() noexcept
+        {
+            auto &values = std::get<find<Type, Fields...>()>(columns_);
+            return std::span{ values.data(), values.size() };
+        }
+
+        template <typename Type>
+        [[nodiscard]] auto column() const noexcept
+        {
+            auto const &values = std::get<find<Type, Fields...>()>(columns_);
+            return std::span{ values.data(), values.size() };
+        }
+
+    private:
+        /*! Makes room for one more value, growing geometrically like emplace_back, so that emplace_back cannot reallocate. */
+        template <typename Column>
+        auto static reserve_one_more(Column &column)
+        {
+            if (column.size() == column.capacity())
+                column.reserve(column.empty() ? 1U : 2U * column.size());
+        }
+
+        template <size_t ...Indices, typename ...Arguments>
+        auto push_back(std::index_sequence<Indices...>, [[maybe_unused]] Arguments &&...arguments)
+        {
+            (reserve_one_more(std::get<Indices>(columns_)), ...);
+
+            auto appended = size_t{ 0 };
+            try
+            {
+                ((std::get<Indices>(columns_).emplace_back(internal::initializer_for<Indices>(typelist<Fields...>{}, std::forward<Arguments>(arguments)...)), ++appended), ...);
+            }
+            catch (...)
+            {
+                ((Indices < appended ? std::get<Indices>(columns_).pop_back() : void()), ...);
+                throw;
+            }
+        }
+
+        std::tuple<std::vector<Fields>...> columns_{};
+    };
+}
+
+#endif //PITYPELISTS_STRUCT_VECTOR_HXX
@@ -1,17 +1,46 @@
 #ifndef PITYPELISTS_TYPEDECL_HXX
 #define PITYPELISTS_TYPEDECL_HXX
 
-#define AUTO_TAG TAG(__COUNTER__)
+// A tag named after the file and the line it is on: the same type in every translation unit that includes that line, so
+// one AUTO_TAG per line. Its type_id_v changes when the file is moved or edited, so it is not a persistent key
+// (dynamic_struct, codec): for a tag that does not depend on where it is written, use tag<"name">.
+#define AUTO_TAG ::pi::td::tag<__FILE__ ":" PI_TD_STRINGIZE(__LINE__)>
 #define TAG(UniqueID) MAKE_TAG(UniqueID)
 #define MAKE_TAG(ID) struct TAG_ ## ID
+#define PI_TD_STRINGIZE(Text) PI_TD_MAKE_STRING(Text)
+#define PI_TD_MAKE_STRING(Text) #Text
 
+#if defined(_MSC_VER)
+#define PI_TD_EMPTY_BASES __declspec(empty_bases)
+#else
+#define PI_TD_EMPTY_BASES
+#endif
+
+#include <cstdint>
+#include <type_traits>
+
+#include <td_hash.hxx>
+#include <td_operators.hxx>
+#include <td_relocation.hxx>
+#include <td_type_id.hxx>
 #include <td_typedecl_base.hxx>
 
 namespace pi::td
 {
-    template <typename Type, typename Tag>
-    struct typedecl : public internal::typedecl_base<Type, Tag>
+    /*!
+     * @brief A strong type over Type: it does not implicitly convert from Type nor from other strong types.
+     * @tparam Type The underlying type
+     * @tparam Tag Makes the strong type unique; see tag, TAG and AUTO_TAG
+     * @tparam Policies Opt-in operators for fundamental types (arithmetic, comparison) that take and return the strong
+     *         type instead of decaying to Type
+     */
+    template <typename Type, typename Tag, typename ...Policies>
+    struct PI_TD_EMPTY_BASES typedecl
+        : public internal::typedecl_base<Type, Tag>
+        , public Policies::template operators<typedecl<Type, Tag, Policies...>, Type>...
     {
+        static_assert(sizeof...(Policies) == 0U || std::is_fundamental_v<Type>, "The operator policies are only available for fundamental types.");
+
         using value_type = Type;
 
         using internal::typedecl_base<Type, Tag>::typedecl_base;
@@ -19,4 +48,20 @@ namespace pi::td
     };
 }
 
+namespace pi::td::internal
+{
+    template <typename Type, typename ...Policies>
+    auto consteval has_the_layout_of_its_type()
+    {
+        using strong_t = typedecl<Type, struct layout_check_tag, Policies...>;
+        return sizeof(strong_t) == sizeof(Type) && alignof(strong_t) == alignof(Type)
+            && std::is_trivially_copyable_v<strong_t> && std::is_standard_layout_v<strong_t>;
+    }
+
+    static_assert(   has_the_layout_of_its_type<double, arithmetic, comparison>() && has_the_layout_of_its_type<float, arithmetic>()
+                  && has_the_layout_of_its_type<int64_t, comparison, arithmetic>() && has_the_layout_of_its_type<char, arithmetic, comparison>()
+                  && has_the_layout_of_its_type<bool, comparison>() && has_the_layout_of_its_type<double>(),
+                  "A typedecl of a fundamental type must have the size, the alignment and the trivial copyability of that type.");
+}
+
 #endif //PITYPELISTS_TYPEDECL_HXX
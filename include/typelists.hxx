@@ -4,6 +4,10 @@
 #include <tl_get.hxx>
 #include <tl_find.hxx>
 #include <tl_matching_strategy.hxx>
+#include <tl_sort.hxx>
+#include <tl_tally.hxx>
+#include <tl_transform.hxx>
+#include <tl_typelist.hxx>
 
 namespace pi::tl
 {
@@ -66,6 +70,128 @@ namespace pi::tl
     template <typename SearchedType, typename ...TypeList>
     [[nodiscard]] auto consteval find();
 
+    /*!
+     * @brief Counts the number of times SearchedType appears in a typelist.
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedType Type to count
+     * @tparam TypeList The types in the typelist
+     * @returns The number of times SearchedType appears in the typelist, respecting the matching Strategy.
+     */
+    template <matching Strategy, typename SearchedType, typename ...TypeList>
+    [[nodiscard]] auto consteval count(typelist<TypeList...>);
+
+    /*!
+     * @brief Counts the number of times SearchedType appears in a typelist, using the relaxed matching strategy.
+     * @tparam SearchedType Type to count
+     * @tparam TypeList The types in the typelist
+     * @returns The number of times SearchedType appears in the typelist.
+     */
+    template <typename SearchedType, typename ...TypeList>
+    [[nodiscard]] auto consteval count(typelist<TypeList...>);
+
+    /*!
+     * @brief Find the index of the Nth SearchedType in a typelist.
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedType Type to find
+     * @tparam Nth The 1-based instance of SearchedType in the typelist
+     * @tparam TypeList The types in the typelist
+     * @returns The 0-based index of SearchedType in the typelist, respecting the matching Strategy.
+     */
+    template <matching Strategy, typename SearchedType, size_t Nth, typename ...TypeList>
+    [[nodiscard]] auto consteval find_nth(typelist<TypeList...>);
+
+    /*!
+     * @brief Find the index of the Nth SearchedType in a typelist, using the relaxed matching strategy.
+     * @tparam SearchedType Type to find
+     * @tparam Nth The 1-based instance of SearchedType in the typelist
+     * @tparam TypeList The types in the typelist
+     * @returns The 0-based index of SearchedType in the typelist.
+     */
+    template <typename SearchedType, size_t Nth, typename ...TypeList>
+    [[nodiscard]] auto consteval find_nth(typelist<TypeList...>);
+
+    /*!
+     * @brief Find the index of the first SearchedType in a typelist.
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedType Type to find
+     * @tparam TypeList The types in the typelist
+     * @returns The 0-based index of SearchedType in the typelist, respecting the matching Strategy.
+     */
+    template <matching Strategy, typename SearchedType, typename ...TypeList>
+    [[nodiscard]] auto consteval find(typelist<TypeList...>);
+
+    /*!
+     * @brief Find the index of the first SearchedType in a typelist, using the relaxed matching strategy.
+     * @tparam SearchedType Type to find
+     * @tparam TypeList The types in the typelist
+     * @returns The 0-based index of SearchedType in the typelist.
+     */
+    template <typename SearchedType, typename ...TypeList>
+    [[nodiscard]] auto consteval find(typelist<TypeList...>);
+
+    /*!
+     * @brief Counts the number of times each of the searched types appears in the TypeList, in a single pass.
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedList A typelist with the types to count
+     * @tparam TypeList Where to look in for the searched types
+     * @returns A std::array with the count of each searched type, in the order of SearchedList, respecting the matching Strategy.
+     * @note count_each<typelist<Searched...>, TypeList...>()[i] is count<Searched_i, TypeList...>(), even when searched types overlap.
+     */
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval count_each();
+
+    /*!
+     * @brief Counts the number of times each of the searched types appears in the TypeList, using the relaxed matching strategy.
+     * @tparam SearchedList A typelist with the types to count
+     * @tparam TypeList Where to look in for the searched types
+     * @returns A std::array with the count of each searched type, in the order of SearchedList.
+     * @note count_each<typelist<Searched...>, TypeList...>()[i] is count<Searched_i, TypeList...>(), even when searched types overlap.
+     */
+    template <typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval count_each();
+
+    /*!
+     * @brief Find the index of the first instance of each of the searched types in the TypeList, in a single pass.
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedList A typelist with the types to find
+     * @tparam TypeList Where to look in for the searched types
+     * @returns A std::array with the 0-based index (or npos) of each searched type, in the order of SearchedList, respecting the matching Strategy.
+     * @note find_each<typelist<Searched...>, TypeList...>()[i] is find<Searched_i, TypeList...>(), even when searched types overlap.
+     */
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval find_each();
+
+    /*!
+     * @brief Find the index of the first instance of each of the searched types in the TypeList, using the relaxed matching strategy.
+     * @tparam SearchedList A typelist with the types to find
+     * @tparam TypeList Where to look in for the searched types
+     * @returns A std::array with the 0-based index (or npos) of each searched type, in the order of SearchedList.
+     * @note find_each<typelist<Searched...>, TypeList...>()[i] is find<Searched_i, TypeList...>(), even when searched types overlap.
+     */
+    template <typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval find_each();
+
+    /*!
+     * @brief Checks that every type in TypeList is one of the searched types (e.g. that there are no unexpected arguments).
+     * @tparam Strategy The matching strategy
+     * @tparam SearchedList A typelist with the accepted types
+     * @tparam TypeList The types to check
+     * @returns true if each type in TypeList matches one of the types in SearchedList, respecting the matching Strategy.
+     * @note Computed in the same pass as count_each and find_each.
+     */
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval contains_only();
+
+    /*!
+     * @brief Checks that every type in TypeList is one of the searched types, using the relaxed matching strategy.
+     * @tparam SearchedList A typelist with the accepted types
+     * @tparam TypeList The types to check
+     * @returns true if each type in TypeList matches one of the types in SearchedList.
+     * @note Computed in the same pass as count_each and find_each.
+     */
+    template <typename SearchedList, typename ...TypeList>
+    [[nodiscard]] auto consteval contains_only();
+
     /*!
      * @brief Get the argument at index Index in TypeList.
      * @tparam Index 0-based index (known at compile time)
@@ -83,11 +209,36 @@ namespace pi::tl
      * @param arguments List of arguments
      * @return The argument at the required index from the argument list.
      * @throws out_of_range if the index is larger than or equal to the number of arguments.
-     * @note Due to a language limitation, the arguments must have compatible types (e.g. int, bool, double, char are allowed, but int, char * are not allowed)
+     * @note Due to a language limitation, the arguments must have compatible types (e.g. int, bool, double, char are allowed, but int, char * are not allowed);
+     *       use get_variant or visit_at for arguments of unrelated types.
      */
     template<typename ...TypeList>
     [[nodiscard]] decltype(auto) constexpr get(size_t index, TypeList &&...arguments);
 
+    /*!
+     * @brief Get a copy of the argument at the required index from the given TypeList, as a variant.
+     * @tparam TypeList List of types (not necessarily compatible)
+     * @param index 0-based index (not necessarily known at compile-time)
+     * @param arguments List of arguments
+     * @return A std::variant<std::remove_cvref_t<TypeList>...> holding the argument at the required index in the alternative with the same index.
+     * @throws out_of_range if the index is larger than or equal to the number of arguments.
+     */
+    template<typename ...TypeList>
+    [[nodiscard]] auto constexpr get_variant(size_t index, TypeList &&...arguments);
+
+    /*!
+     * @brief Invoke the visitor with the argument at the required index from the given TypeList.
+     * @tparam Visitor Callable with each type in TypeList
+     * @tparam TypeList List of types (not necessarily compatible)
+     * @param index 0-based index (not necessarily known at compile-time)
+     * @param visitor The callable; the argument is forwarded to it, without copies
+     * @param arguments List of arguments
+     * @return What the visitor returns, converted to the common type of its results for all types in TypeList.
+     * @throws out_of_range if the index is larger than or equal to the number of arguments.
+     */
+    template<typename Visitor, typename ...TypeList>
+    decltype(auto) constexpr visit_at(size_t index, Visitor &&visitor, TypeList &&...arguments);
+
     /*!
      * @brief Get the first argument of a certain type or the given default value, respecting the matching strategy.
      * @tparam Strategy The matching strategy
@@ -136,6 +287,54 @@ namespace pi::tl
     template <size_t Nth, typename SearchedType, typename ...TypeList>
     [[nodiscard]] auto constexpr get_nth_or_initialize(SearchedType default_value, TypeList &&...arguments);
 
+    /*!
+     * @brief Get the first argument of a certain type or, only if there is none, the result of invoking the default factory.
+     * @tparam Strategy The matching strategy
+     * @tparam Factory Callable without arguments; SearchedType is the decayed type it returns
+     * @tparam TypeList List of types
+     * @param default_factory Invoked to make the fall-back value in case there is no matching argument
+     * @param arguments List of arguments
+     * @return The first argument of the same type, respecting the matching strategy, by reference if it is an lvalue and moved into the result if it is an rvalue, or the result of default_factory().
+     */
+    template <matching Strategy, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_or_invoke(Factory &&default_factory, TypeList &&...arguments);
+
+    /*!
+     * @brief Get the first argument of a certain type or, only if there is none, the result of invoking the default factory, using relaxed strategy.
+     * @tparam Factory Callable without arguments; SearchedType is the decayed type it returns
+     * @tparam TypeList List of types
+     * @param default_factory Invoked to make the fall-back value in case there is no matching argument
+     * @param arguments List of arguments
+     * @return The first argument of the same type, by reference if it is an lvalue and moved into the result if it is an rvalue, or the result of default_factory().
+     */
+    template <typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_or_invoke(Factory &&default_factory, TypeList &&...arguments);
+
+    /*!
+     * @brief Get the nth argument of a certain type or, only if there is none, the result of invoking the default factory.
+     * @tparam Strategy The matching strategy
+     * @tparam Nth The 1-based index of the argument of the SearchedType
+     * @tparam Factory Callable without arguments; SearchedType is the decayed type it returns
+     * @tparam TypeList List of types
+     * @param default_factory Invoked to make the fall-back value in case there is no matching argument
+     * @param arguments List of arguments
+     * @return The nth argument of the same type, respecting the matching strategy, by reference if it is an lvalue and moved into the result if it is an rvalue, or the result of default_factory().
+     */
+    template <matching Strategy, size_t Nth, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_nth_or_invoke(Factory &&default_factory, TypeList &&...arguments);
+
+    /*!
+     * @brief Get the nth argument of a certain type or, only if there is none, the result of invoking the default factory, using relaxed strategy.
+     * @tparam Nth The 1-based index of the argument of the SearchedType
+     * @tparam Factory Callable without arguments; SearchedType is the decayed type it returns
+     * @tparam TypeList List of types
+     * @param default_factory Invoked to make the fall-back value in case there is no matching argument
+     * @param arguments List of arguments
+     * @return The nth argument of the same type, by reference if it is an lvalue and moved into the result if it is an rvalue, or the result of default_factory().
+     */
+    template <size_t Nth, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_nth_or_invoke(Factory &&default_factory, TypeList &&...arguments);
+
     /*!
      * @brief Get the argument of the given type and index or the default value, respecting the matching strategy.
      * @tparam Strategy The matching strategy
@@ -201,6 +400,84 @@ namespace pi::tl
         return find_nth<matching::relaxed, SearchedType, 1, TypeList...>();
     }
 
+    template <matching Strategy, typename SearchedType, typename ...TypeList>
+    auto consteval count(typelist<TypeList...>)
+    {
+        return internal::position_table<apply_strategy_t<Strategy, SearchedType>, apply_strategy_t<Strategy, TypeList>...>.size();
+    }
+
+    template <typename SearchedType, typename ...TypeList>
+    auto consteval count(typelist<TypeList...> const list)
+    {
+        return count<matching::relaxed, SearchedType>(list);
+    }
+
+    template <matching Strategy, typename SearchedType, size_t Nth, typename ...TypeList>
+    auto consteval find_nth(typelist<TypeList...>)
+    {
+        static_assert(Nth > 0U, "Nth is a 1-based index representing which 'instance' of SearchedType you want to search for.");
+
+        auto constexpr &positions = internal::position_table<apply_strategy_t<Strategy, SearchedType>, apply_strategy_t<Strategy, TypeList>...>;
+        if constexpr (Nth <= positions.size())
+            return static_cast<int64_t>(positions[Nth - 1U]);
+        else
+            return npos;
+    }
+
+    template <typename SearchedType, size_t Nth, typename ...TypeList>
+    auto consteval find_nth(typelist<TypeList...> const list)
+    {
+        return find_nth<matching::relaxed, SearchedType, Nth>(list);
+    }
+
+    template <matching Strategy, typename SearchedType, typename ...TypeList>
+    auto consteval find(typelist<TypeList...> const list)
+    {
+        return find_nth<Strategy, SearchedType, 1>(list);
+    }
+
+    template <typename SearchedType, typename ...TypeList>
+    auto consteval find(typelist<TypeList...> const list)
+    {
+        return find_nth<matching::relaxed, SearchedType, 1>(list);
+    }
+
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    auto consteval count_each()
+    {
+        return internal::tally<Strategy, SearchedList, TypeList...>::value.counts;
+    }
+
+    template <typename SearchedList, typename ...TypeList>
+    auto consteval count_each()
+    {
+        return count_each<matching::relaxed, SearchedList, TypeList...>();
+    }
+
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    auto consteval find_each()
+    {
+        return internal::tally<Strategy, SearchedList, TypeList...>::value.first_positions;
+    }
+
+    template <typename SearchedList, typename ...TypeList>
+    auto consteval find_each()
+    {
+        return find_each<matching::relaxed, SearchedList, TypeList...>();
+    }
+
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    auto consteval contains_only()
+    {
+        return internal::tally<Strategy, SearchedList, TypeList...>::value.unmatched == 0U;
+    }
+
+    template <typename SearchedList, typename ...TypeList>
+    auto consteval contains_only()
+    {
+        return contains_only<matching::relaxed, SearchedList, TypeList...>();
+    }
+
     template<size_t Index, typename ...TypeList>
     [[nodiscard]] decltype(auto) constexpr get(TypeList &&...arguments)
     {
@@ -213,6 +490,18 @@ namespace pi::tl
         return internal::get<TypeList...>(index, std::forward<TypeList>(arguments)...);
     }
 
+    template<typename ...TypeList>
+    [[nodiscard]] auto constexpr get_variant(size_t const index, TypeList &&...arguments)
+    {
+        return internal::get_variant<TypeList...>(index, std::forward<TypeList>(arguments)...);
+    }
+
+    template<typename Visitor, typename ...TypeList>
+    decltype(auto) constexpr visit_at(size_t const index, Visitor &&visitor, TypeList &&...arguments)
+    {
+        return internal::visit_at<Visitor, TypeList...>(index, std::forward<Visitor>(visitor), std::forward<TypeList>(arguments)...);
+    }
+
     template <matching Strategy, typename SearchedType, typename ...TypeList>
     [[nodiscard]] auto constexpr get_or_initialize(SearchedType default_value, TypeList &&...arguments)
     {
@@ -245,13 +534,45 @@ namespace pi::tl
               , std::forward<TypeList>(arguments)...);
     }
 
+    template <matching Strategy, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_or_invoke(Factory &&default_factory, TypeList &&...arguments)
+    {
+        return get_nth_or_invoke<Strategy, 1ULL, Factory, TypeList...>(std::forward<Factory>(default_factory), std::forward<TypeList>(arguments)...);
+    }
+
+    template <typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_or_invoke(Factory &&default_factory, TypeList &&...arguments)
+    {
+        return get_nth_or_invoke<matching::relaxed, 1ULL, Factory, TypeList...>(std::forward<Factory>(default_factory), std::forward<TypeList>(arguments)...);
+    }
+
+    template <matching Strategy, size_t Nth, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_nth_or_invoke(Factory &&default_factory, TypeList &&...arguments)
+    {
+        using searched_type_t = std::decay_t<std::invoke_result_t<Factory>>;
+
+        return internal::get_or_invoke<find_nth<Strategy, searched_type_t, Nth, TypeList...>(), Factory, TypeList...>(
+                std::forward<Factory>(default_factory)
+              , std::forward<TypeList>(arguments)...);
+    }
+
+    template <size_t Nth, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_nth_or_invoke(Factory &&default_factory, TypeList &&...arguments)
+    {
+        return get_nth_or_invoke<matching::relaxed, Nth, Factory, TypeList...>(std::forward<Factory>(default_factory), std::forward<TypeList>(arguments)...);
+    }
+
     template <matching Strategy, typename SearchedType, typename ...TypeList>
     [[nodiscard]] auto constexpr get_nth_or_initialize(size_t const index, SearchedType default_value, TypeList &&...arguments)
     {
-        return internal::get_or_initialize<apply_strategy_t<Strategy, SearchedType>, apply_strategy_t<Strategy, TypeList>...>(
-                index
-              , apply_strategy_t<Strategy, SearchedType>(default_value)
-              , apply_strategy_t<Strategy, TypeList>(arguments)...);
+        using searched_type_t = apply_strategy_t<Strategy, SearchedType>;
+        using positions_t = internal::position_sequence_t<searched_type_t, apply_strategy_t<Strategy, TypeList>...>;
+
+        return internal::get_or_initialize<searched_type_t>(
+                positions_t{}
+              , index
+              , searched_type_t(default_value)
+              , std::forward<TypeList>(arguments)...);
     }
 
     template <typename SearchedType, typename ...TypeList>
@@ -264,4 +585,82 @@ namespace pi::tl
     }
 }
 
+namespace pi::tl
+{
+    /*!
+     * @brief The types of List, a typelist, sorted by a key derived from their names: the order is the same in every
+     *        translation unit (for a given compiler). Duplicates are kept, in the order of List.
+     * @note Computed by a constexpr sort of the keys: the instantiation depth does not grow with the size of List.
+     */
+    template <typename List>
+    using sort_t = internal::select_t<List, internal::order_table<List>::sorted>;
+
+    /*! The first instance of each distinct type of List, a typelist, in the order of List. */
+    template <typename List>
+    using unique_t = internal::select_t<List, internal::unique_positions<List>>;
+
+    /*!
+     * @brief The distinct types of List, a typelist, sorted like sort_t does.
+     * Lists with the same set of types have the same canonical form, e.g. typelist<B, A, B> and typelist<A, B>.
+     */
+    template <typename List>
+    using canonical_t = internal::select_t<List, internal::canonical_positions<List>>;
+
+    /*! The distinct types that are in Left or in Right (typelists), in canonical form. */
+    template <typename Left, typename Right>
+    using set_union_t = canonical_t<typename internal::concat<Left, Right>::type>;
+
+    /*! The distinct types that are in both Left and Right (typelists), in canonical form. */
+    template <typename Left, typename Right>
+    using set_intersection_t = internal::select_t<Left, internal::intersection_positions<Left, Right>>;
+
+    /*! The types of all the Lists (typelists), in order. */
+    template <typename ...Lists>
+    using concat_t = typename internal::concat<Lists...>::type;
+
+    /*!
+     * @brief The types of List, a typelist, for which Predicate<Type>::value is true, in order.
+     * @tparam Strategy The matching strategy: Predicate is given the types without modifiers, unless it is strict
+     */
+    template <template <typename> typename Predicate, typename List, matching Strategy = matching::relaxed>
+    using filter_t = typename internal::filter<Predicate, Strategy, true, List>::type;
+
+    /*!
+     * @brief Transform<Type> for each type of List, a typelist, e.g. transform_t<std::add_pointer_t, typelist<int, char>>.
+     * @tparam Strategy The matching strategy; default is strict: Transform is given the types as they are, modifiers
+     *         included, unless it is relaxed
+     */
+    template <template <typename> typename Transform, typename List, matching Strategy = matching::strict>
+    using transform_t = typename internal::transform<Transform, Strategy, List>::type;
+
+    /*!
+     * @brief A typelist of two typelists: the types of List for which Predicate<Type>::value is true, then the others.
+     * Each keeps the order of List.
+     * @tparam Strategy The matching strategy: Predicate is given the types without modifiers, unless it is strict
+     */
+    template <template <typename> typename Predicate, typename List, matching Strategy = matching::relaxed>
+    using partition_t = typelist<filter_t<Predicate, List, Strategy>, typename internal::filter<Predicate, Strategy, false, List>::type>;
+
+    /*! The types of List, a typelist, at the 0-based positions from Begin up to (but excluding) End. */
+    template <typename List, size_t Begin, size_t End>
+    using slice_t = typename internal::slice<List, Begin, End>::type;
+
+    /*! The types of List, a typelist, in reverse order. */
+    template <typename List>
+    using reverse_t = typename internal::reverse<List>::type;
+
+    template <template <typename ...> typename Template, typename List>
+    struct apply;
+
+    template <template <typename ...> typename Template, typename ...TypeList>
+    struct apply<Template, typelist<TypeList...>>
+    {
+        using type = Template<TypeList...>;
+    };
+
+    /*! Template instantiated with the types of List, e.g. apply_t<struct_t, canonical_t<typelist<B, A>>>. */
+    template <template <typename ...> typename Template, typename List>
+    using apply_t = typename apply<Template, List>::type;
+}
+
 #endif
@@ -0,0 +1,113 @@
+#ifndef PITYPELISTS_TD_HASH_HXX
+#define PITYPELISTS_TD_HASH_HXX
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace pi::td
+{
+    template <typename Type, typename Tag, typename ...Policies>
+    struct typedecl;
+}
+
+namespace pi::td::internal
+{
+    /*! The finalizer of MurmurHash3: every bit of value changes about half of the bits of the result. */
+    [[nodiscard]] uint64_t constexpr mix(uint64_t value) noexcept
+    {
+        value ^= value >> 33U;
+        value *= 0xff51afd7ed558ccdULL;
+        value ^= value >> 33U;
+        value *= 0xc4ceb9fe1a85ec53ULL;
+        value ^= value >> 33U;
+        return value;
+    }
+
+    /*! Mixes hash into seed; the result depends on the order the hashes are combined in. */
+    [[nodiscard]] uint64_t constexpr combine(uint64_t const seed, uint64_t const hash) noexcept
+    {
+        return mix(seed + 0x9e3779b97f4a7c15ULL + hash);
+    }
+
+    /*! Hashes size bytes eight at a time, then the zero-padded tail; the words are read with memcpy, unaligned. */
+    [[nodiscard]] inline uint64_t hash_bytes(void const *data, size_t size) noexcept
+    {
+        auto const *bytes = static_cast<unsigned char const *>(data);
+        auto hash = 0x9e3779b97f4a7c15ULL ^ (size * 0x87c37b91114253d5ULL);
+
+        for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t))
+        {
+            auto word = uint64_t{};
+            std::memcpy(&word, bytes, sizeof(uint64_t));
+            hash = std::rotl(hash ^ (word * 0x87c37b91114253d5ULL), 31) * 0x4cf5ad432745937fULL;
+        }
+
+        if (size != 0U)
+        {
+            auto word = uint64_t{};
+            std::memcpy(&word, bytes, size);
+            hash = std::rotl(hash ^ (word * 0x87c37b91114253d5ULL), 31) * 0x4cf5ad432745937fULL;
+        }
+
+        return mix(hash);
+    }
+
+    template <typename Type>
+    bool constexpr is_hashable_v = std::is_default_constructible_v<std::hash<Type>>;
+
+    template <typename Type, typename Tag, typename ...Policies>
+    [[nodiscard]] decltype(auto) constexpr underlying_value(typedecl<Type, Tag, Policies...> const &value) noexcept
+    {
+        if constexpr (!std::is_class_v<Type>)
+            return static_cast<Type>(value);
+        else if constexpr (std::is_final_v<Type>)
+            return *value;
+        else
+            return static_cast<Type const &>(value);
+    }
+}
+
+namespace pi::td
+{
+    /*!
+     * @brief A transparent hasher: a typedecl has the hash of its underlying value, so with std::equal_to<> a table keyed
+     * by a strong type can be searched with the raw value (or with a type that std::hash hashes the same way, e.g.
+     * std::string_view for std::string), without building a key:
+     * std::unordered_map<id_t, row_t, transparent_hash, std::equal_to<>>::find(42).
+     */
+    struct transparent_hash
+    {
+        using is_transparent = void;
+
+        template <typename Key>
+        requires internal::is_hashable_v<Key>
+        [[nodiscard]] size_t operator ()(Key const &key) const noexcept(noexcept(std::hash<Key>{}(key)))
+        {
+            return std::hash<Key>{}(key);
+        }
+    };
+}
+
+namespace std
+{
+    /*!
+     * @brief A typedecl is hashable when its underlying type is, and it has the same hash: the hash is not mixed further,
+     * which would cost as much again for integers and scatter sequential IDs over the buckets of std::unordered_map.
+     */
+    template <typename Type, typename Tag, typename ...Policies>
+    requires pi::td::internal::is_hashable_v<Type>
+    struct hash<pi::td::typedecl<Type, Tag, Policies...>>
+    {
+        [[nodiscard]] size_t operator ()(pi::td::typedecl<Type, Tag, Policies...> const &value) const
+            noexcept(noexcept(hash<Type>{}(declval<Type const &>())))
+        {
+            return hash<Type>{}(pi::td::internal::underlying_value(value));
+        }
+    };
+}
+
+#endif //PITYPELISTS_TD_HASH_HXX
@@ -0,0 +1,237 @@
+#ifndef PITYPELISTS_TD_OPERATORS_HXX
+#define PITYPELISTS_TD_OPERATORS_HXX
+
+#include <compare>
+#include <type_traits>
+
+namespace pi::td
+{
+    template <typename Type, typename Tag, typename ...Policies>
+    struct typedecl;
+}
+
+namespace pi::td::internal
+{
+    /*!
+     * @brief The arithmetic operators of Strong, a typedecl over the fundamental type Type: they take and return Strong.
+     * Adding or subtracting a raw Type, or a typedecl with another tag, does not compile; Strong can be scaled by a Type.
+     */
+    template <typename Strong, typename Type>
+    struct arithmetic_operators
+    {
+        static_assert(std::is_arithmetic_v<Type> && !std::is_same_v<Type, bool>, "The arithmetic operators are only available for numbers.");
+
+        [[nodiscard]] friend constexpr Strong operator +(Strong const value) noexcept
+        {
+            return value;
+        }
+
+        [[nodiscard]] friend constexpr Strong operator -(Strong const value) noexcept
+        {
+            return Strong{ static_cast<Type>(-static_cast<Type>(value)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator +(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) + static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator -(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) - static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator *(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) * static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator /(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) / static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator %(Strong const left, Strong const right) noexcept requires std::is_integral_v<Type>
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) % static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator *(Strong const left, Type const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) * right) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator *(Type const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(left * static_cast<Type>(right)) };
+        }
+
+        [[nodiscard]] friend constexpr Strong operator /(Strong const left, Type const right) noexcept
+        {
+            return Strong{ static_cast<Type>(static_cast<Type>(left) / right) };
+        }
+
+        friend constexpr Strong &operator +=(Strong &left, Strong const right) noexcept
+        {
+            return left = left + right;
+        }
+
+        friend constexpr Strong &operator -=(Strong &left, Strong const right) noexcept
+        {
+            return left = left - right;
+        }
+
+        friend constexpr Strong &operator *=(Strong &left, Strong const right) noexcept
+        {
+            return left = left * right;
+        }
+
+        friend constexpr Strong &operator /=(Strong &left, Strong const right) noexcept
+        {
+            return left = left / right;
+        }
+
+        friend constexpr Strong &operator %=(Strong &left, Strong const right) noexcept requires std::is_integral_v<Type>
+        {
+            return left = left % right;
+        }
+
+        friend constexpr Strong &operator *=(Strong &left, Type const right) noexcept
+        {
+            return left = left * right;
+        }
+
+        friend constexpr Strong &operator /=(Strong &left, Type const right) noexcept
+        {
+            return left = left / right;
+        }
+
+        friend constexpr Strong &operator ++(Strong &value) noexcept requires std::is_integral_v<Type>
+        {
+            return value = Strong{ static_cast<Type>(static_cast<Type>(value) + Type{ 1 }) };
+        }
+
+        friend constexpr Strong &operator --(Strong &value) noexcept requires std::is_integral_v<Type>
+        {
+            return value = Strong{ static_cast<Type>(static_cast<Type>(value) - Type{ 1 }) };
+        }
+
+        friend constexpr Strong operator ++(Strong &value, int) noexcept requires std::is_integral_v<Type>
+        {
+            auto const previous = value;
+            ++value;
+            return previous;
+        }
+
+        friend constexpr Strong operator --(Strong &value, int) noexcept requires std::is_integral_v<Type>
+        {
+            auto const previous = value;
+            --value;
+            return previous;
+        }
+
+        // Without these, the operands would be converted to Type and the result would lose the tag.
+        friend void operator +(Strong, Type) = delete;
+        friend void operator +(Type, Strong) = delete;
+        friend void operator -(Strong, Type) = delete;
+        friend void operator -(Type, Strong) = delete;
+
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator +(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator +(typedecl<OtherType, OtherTag, OtherPolicies...>, Strong) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator -(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator -(typedecl<OtherType, OtherTag, OtherPolicies...>, Strong) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator *(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator *(typedecl<OtherType, OtherTag, OtherPolicies...>, Strong) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator /(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend void operator /(typedecl<OtherType, OtherTag, OtherPolicies...>, Strong) = delete;
+    };
+
+    /*!
+     * @brief The comparison operators of Strong, a typedecl over the fundamental type Type.
+     * Comparing with a typedecl with another tag does not compile; comparing with a raw Type still does.
+     */
+    template <typename Strong, typename Type>
+    struct comparison_operators
+    {
+        [[nodiscard]] friend constexpr bool operator ==(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) == static_cast<Type>(right);
+        }
+
+        [[nodiscard]] friend constexpr auto operator <=>(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) <=> static_cast<Type>(right);
+        }
+
+        // Spelled out, rather than rewritten in terms of <=>, so that they compile to a single comparison of the values
+        // (for floating point types, the rewritten ones test the ordering for unordered, then for less).
+        [[nodiscard]] friend constexpr bool operator <(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) < static_cast<Type>(right);
+        }
+
+        [[nodiscard]] friend constexpr bool operator >(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) > static_cast<Type>(right);
+        }
+
+        [[nodiscard]] friend constexpr bool operator <=(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) <= static_cast<Type>(right);
+        }
+
+        [[nodiscard]] friend constexpr bool operator >=(Strong const left, Strong const right) noexcept
+        {
+            return static_cast<Type>(left) >= static_cast<Type>(right);
+        }
+
+        /*! Found by ADL; they compare and select the values, so that they vectorize like the ones of Type do. */
+        [[nodiscard]] friend constexpr Strong min(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(right) < static_cast<Type>(left) ? static_cast<Type>(right) : static_cast<Type>(left) };
+        }
+
+        [[nodiscard]] friend constexpr Strong max(Strong const left, Strong const right) noexcept
+        {
+            return Strong{ static_cast<Type>(left) < static_cast<Type>(right) ? static_cast<Type>(right) : static_cast<Type>(left) };
+        }
+
+        [[nodiscard]] friend constexpr Strong clamp(Strong const value, Strong const low, Strong const high) noexcept
+        {
+            auto const raw = static_cast<Type>(value);
+            return Strong{ raw < static_cast<Type>(low) ? static_cast<Type>(low) : (static_cast<Type>(high) < raw ? static_cast<Type>(high) : raw) };
+        }
+
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend bool operator ==(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+        template <typename OtherType, typename OtherTag, typename ...OtherPolicies>
+        friend bool operator <=>(Strong, typedecl<OtherType, OtherTag, OtherPolicies...>) = delete;
+    };
+}
+
+namespace pi::td
+{
+    /*! Opts a typedecl over a number into the arithmetic operators that keep its tag: typedecl<double, Tag, arithmetic>. */
+    struct arithmetic
+    {
+        template <typename Strong, typename Type>
+        using operators = internal::arithmetic_operators<Strong, Type>;
+    };
+
+    /*! Opts a typedecl over a fundamental type into the comparison operators that keep its tag. */
+    struct comparison
+    {
+        template <typename Strong, typename Type>
+        using operators = internal::comparison_operators<Strong, Type>;
+    };
+}
+
+#endif //PITYPELISTS_TD_OPERATORS_HXX
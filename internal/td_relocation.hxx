@@ -0,0 +1,68 @@
+#ifndef PITYPELISTS_TD_RELOCATION_HXX
+#define PITYPELISTS_TD_RELOCATION_HXX
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace pi::td
+{
+    template <typename Type, typename Tag, typename ...Policies>
+    struct typedecl;
+
+    /*!
+     * @brief Whether moving a Type to a new address and destroying the original can be done by copying its bytes.
+     * True for the trivially copyable types, for the typedecls of trivially relocatable types and, by specialization, for
+     * the other types that hold no pointer to themselves (e.g. a std::unique_ptr, with the usual implementations).
+     */
+    template <typename Type>
+    struct is_trivially_relocatable : std::is_trivially_copyable<Type> {};
+
+    template <typename Type, typename Tag, typename ...Policies>
+    struct is_trivially_relocatable<typedecl<Type, Tag, Policies...>> : is_trivially_relocatable<Type> {};
+
+    template <typename Type>
+    bool constexpr is_trivially_relocatable_v = is_trivially_relocatable<Type>::value;
+
+    /*!
+     * @brief Moves [first, last) to the uninitialized storage at destination and ends the lifetime of the originals.
+     * Trivially relocatable types are moved with a single memmove; the others one by one, with their move constructor.
+     * @returns The end of the relocated range.
+     * @note The two ranges may overlap: when destination is after first, the elements are moved from the last one, so
+     *       that none is overwritten before it is moved. If a move constructor throws, the elements already moved stay
+     *       at destination and the others at first.
+     */
+    template <typename Type>
+    Type *relocate(Type *const first, Type *const last, Type *const destination)
+        noexcept(is_trivially_relocatable_v<Type> || std::is_nothrow_move_constructible_v<Type>)
+    {
+        auto const count = static_cast<size_t>(last - first);
+        if constexpr (is_trivially_relocatable_v<Type>)
+        {
+            if (count > 0U)
+                std::memmove(static_cast<void *>(destination), static_cast<void const *>(first), count * sizeof(Type));
+        }
+        else if (destination > first && destination < last)
+        {
+            for (auto index = count; index > 0U; --index)
+            {
+                std::construct_at(destination + index - 1U, std::move(first[index - 1U]));
+                std::destroy_at(first + index - 1U);
+            }
+        }
+        else
+        {
+            for (auto index = size_t{ 0 }; index < count; ++index)
+            {
+                std::construct_at(destination + index, std::move(first[index]));
+                std::destroy_at(first + index);
+            }
+        }
+
+        return destination + count;
+    }
+}
+
+#endif //PITYPELISTS_TD_RELOCATION_HXX
@@ -0,0 +1,318 @@
+#ifndef PITYPELISTS_TD_SIMD_HXX
+#define PITYPELISTS_TD_SIMD_HXX
+
+#include <cstddef>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#if defined(__GNUC__) && !defined(__clang__)
+// GCC reports the _mm512_undefined_* registers used by the AVX-512 intrinsics as maybe uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#include <immintrin.h>
+#pragma GCC diagnostic pop
+#else
+#include <immintrin.h>
+#endif
+#endif
+
+namespace pi::td::internal
+{
+    /*! Scalar operations; they give the same results as the vector ones, including for NaN in min and max. */
+    struct scalar_operations
+    {
+        template <typename Type>
+        [[nodiscard]] static constexpr Type min(Type const left, Type const right) noexcept { return left < right ? left : right; }
+
+        template <typename Type>
+        [[nodiscard]] static constexpr Type max(Type const left, Type const right) noexcept { return left > right ? left : right; }
+
+        template <typename Type>
+        [[nodiscard]] static constexpr Type fma(Type const left, Type const right, Type const addend) noexcept { return left * right + addend; }
+    };
+
+    /*!
+     * @brief The vector registers and operations for Type, for the widest instruction set enabled at compile time.
+     * @note Only float and double have a vector implementation; the kernels use the scalar loop for the other types.
+     */
+    template <typename Type>
+    struct vector_operations
+    {
+        bool static constexpr enabled = false;
+    };
+
+#if defined(__AVX512F__)
+    template <>
+    struct vector_operations<double>
+    {
+        bool static constexpr enabled = true;
+        size_t static constexpr width = 8U;
+        using register_t = __m512d;
+
+        [[nodiscard]] static register_t load(double const *const values) noexcept { return _mm512_loadu_pd(values); }
+        static void store(double *const values, register_t const value) noexcept { _mm512_storeu_pd(values, value); }
+        [[nodiscard]] static register_t broadcast(double const value) noexcept { return _mm512_set1_pd(value); }
+
+        [[nodiscard]] static register_t add(register_t const left, register_t const right) noexcept { return _mm512_add_pd(left, right); }
+        [[nodiscard]] static register_t subtract(register_t const left, register_t const right) noexcept { return _mm512_sub_pd(left, right); }
+        [[nodiscard]] static register_t multiply(register_t const left, register_t const right) noexcept { return _mm512_mul_pd(left, right); }
+        [[nodiscard]] static register_t divide(register_t const left, register_t const right) noexcept { return _mm512_div_pd(left, right); }
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return _mm512_fmadd_pd(left, right, addend); }
+        [[nodiscard]] static register_t min(register_t const left, register_t const right) noexcept { return _mm512_min_pd(left, right); }
+        [[nodiscard]] static register_t max(register_t const left, register_t const right) noexcept { return _mm512_max_pd(left, right); }
+
+        [[nodiscard]] static double reduce_add(register_t const value) noexcept { return _mm512_reduce_add_pd(value); }
+        [[nodiscard]] static double reduce_min(register_t const value) noexcept { return _mm512_reduce_min_pd(value); }
+        [[nodiscard]] static double reduce_max(register_t const value) noexcept { return _mm512_reduce_max_pd(value); }
+    };
+
+    template <>
+    struct vector_operations<float>
+    {
+        bool static constexpr enabled = true;
+        size_t static constexpr width = 16U;
+        using register_t = __m512;
+
+        [[nodiscard]] static register_t load(float const *const values) noexcept { return _mm512_loadu_ps(values); }
+        static void store(float *const values, register_t const value) noexcept { _mm512_storeu_ps(values, value); }
+        [[nodiscard]] static register_t broadcast(float const value) noexcept { return _mm512_set1_ps(value); }
+
+        [[nodiscard]] static register_t add(register_t const left, register_t const right) noexcept { return _mm512_add_ps(left, right); }
+        [[nodiscard]] static register_t subtract(register_t const left, register_t const right) noexcept { return _mm512_sub_ps(left, right); }
+        [[nodiscard]] static register_t multiply(register_t const left, register_t const right) noexcept { return _mm512_mul_ps(left, right); }
+        [[nodiscard]] static register_t divide(register_t const left, register_t const right) noexcept { return _mm512_div_ps(left, right); }
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return _mm512_fmadd_ps(left, right, addend); }
+        [[nodiscard]] static register_t min(register_t const left, register_t const right) noexcept { return _mm512_min_ps(left, right); }
+        [[nodiscard]] static register_t max(register_t const left, register_t const right) noexcept { return _mm512_max_ps(left, right); }
+
+        [[nodiscard]] static float reduce_add(register_t const value) noexcept { return _mm512_reduce_add_ps(value); }
+        [[nodiscard]] static float reduce_min(register_t const value) noexcept { return _mm512_reduce_min_ps(value); }
+        [[nodiscard]] static float reduce_max(register_t const value) noexcept { return _mm512_reduce_max_ps(value); }
+    };
+#elif defined(__AVX2__)
+    template <>
+    struct vector_operations<double>
+    {
+        bool static constexpr enabled = true;
+        size_t static constexpr width = 4U;
+        using register_t = __m256d;
+
+        [[nodiscard]] static register_t load(double const *const values) noexcept { return _mm256_loadu_pd(values); }
+        static void store(double *const values, register_t const value) noexcept { _mm256_storeu_pd(values, value); }
+        [[nodiscard]] static register_t broadcast(double const value) noexcept { return _mm256_set1_pd(value); }
+
+        [[nodiscard]] static register_t add(register_t const left, register_t const right) noexcept { return _mm256_add_pd(left, right); }
+        [[nodiscard]] static register_t subtract(register_t const left, register_t const right) noexcept { return _mm256_sub_pd(left, right); }
+        [[nodiscard]] static register_t multiply(register_t const left, register_t const right) noexcept { return _mm256_mul_pd(left, right); }
+        [[nodiscard]] static register_t divide(register_t const left, register_t const right) noexcept { return _mm256_div_pd(left, right); }
+#if defined(__FMA__)
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return _mm256_fmadd_pd(left, right, addend); }
+#else
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return add(multiply(left, right), addend); }
+#endif
+        [[nodiscard]] static register_t min(register_t const left, register_t const right) noexcept { return _mm256_min_pd(left, right); }
+        [[nodiscard]] static register_t max(register_t const left, register_t const right) noexcept { return _mm256_max_pd(left, right); }
+
+        [[nodiscard]] static double reduce_add(register_t const value) noexcept
+        {
+            auto const pairs = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+            return _mm_cvtsd_f64(_mm_add_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+        }
+
+        [[nodiscard]] static double reduce_min(register_t const value) noexcept
+        {
+            auto const pairs = _mm_min_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+            return _mm_cvtsd_f64(_mm_min_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+        }
+
+        [[nodiscard]] static double reduce_max(register_t const value) noexcept
+        {
+            auto const pairs = _mm_max_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+            return _mm_cvtsd_f64(_mm_max_sd(pairs, _mm_unpackhi_pd(pairs, pairs)));
+        }
+    };
+
+    template <>
+    struct vector_operations<float>
+    {
+        bool static constexpr enabled = true;
+        size_t static constexpr width = 8U;
+        using register_t = __m256;
+
+        [[nodiscard]] static register_t load(float const *const values) noexcept { return _mm256_loadu_ps(values); }
+        static void store(float *const values, register_t const value) noexcept { _mm256_storeu_ps(values, value); }
+        [[nodiscard]] static register_t broadcast(float const value) noexcept { return _mm256_set1_ps(value); }
+
+        [[nodiscard]] static register_t add(register_t const left, register_t const right) noexcept { return _mm256_add_ps(left, right); }
+        [[nodiscard]] static register_t subtract(register_t const left, register_t const right) noexcept { return _mm256_sub_ps(left, right); }
+        [[nodiscard]] static register_t multiply(register_t const left, register_t const right) noexcept { return _mm256_mul_ps(left, right); }
+        [[nodiscard]] static register_t divide(register_t const left, register_t const right) noexcept { return _mm256_div_ps(left, right); }
+#if defined(__FMA__)
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return _mm256_fmadd_ps(left, right, addend); }
+#else
+        [[nodiscard]] static register_t fma(register_t const left, register_t const right, register_t const addend) noexcept { return add(multiply(left, right), addend); }
+#endif
+        [[nodiscard]] static register_t min(register_t const left, register_t const right) noexcept { return _mm256_min_ps(left, right); }
+        [[nodiscard]] static register_t max(register_t const left, register_t const right) noexcept { return _mm256_max_ps(left, right); }
+
+        [[nodiscard]] static float reduce_add(register_t const value) noexcept
+        {
+            auto quads = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            quads = _mm_add_ps(quads, _mm_movehl_ps(quads, quads));
+            return _mm_cvtss_f32(_mm_add_ss(quads, _mm_movehdup_ps(quads)));
+        }
+
+        [[nodiscard]] static float reduce_min(register_t const value) noexcept
+        {
+            auto quads = _mm_min_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            quads = _mm_min_ps(quads, _mm_movehl_ps(quads, quads));
+            return _mm_cvtss_f32(_mm_min_ss(quads, _mm_movehdup_ps(quads)));
+        }
+
+        [[nodiscard]] static float reduce_max(register_t const value) noexcept
+        {
+            auto quads = _mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+            quads = _mm_max_ps(quads, _mm_movehl_ps(quads, quads));
+            return _mm_cvtss_f32(_mm_max_ss(quads, _mm_movehdup_ps(quads)));
+        }
+    };
+#endif
+
+    /*!
+     * @brief The element-wise operations; vector<Operations> works on the registers of Operations, a vector_operations,
+     *        and scalar on single values, and both compute the same thing.
+     */
+    struct add_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::add(left, right); }
+
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto reduce(Register const value) const noexcept { return Operations::reduce_add(value); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return static_cast<Type>(left + right); }
+    };
+
+    struct subtract_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::subtract(left, right); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return static_cast<Type>(left - right); }
+    };
+
+    struct multiply_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::multiply(left, right); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return static_cast<Type>(left * right); }
+    };
+
+    struct divide_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::divide(left, right); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return static_cast<Type>(left / right); }
+    };
+
+    struct fma_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right, Register const addend) const noexcept { return Operations::fma(left, right, addend); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right, Type const addend) const noexcept { return scalar_operations::fma(left, right, addend); }
+    };
+
+    struct min_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::min(left, right); }
+
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto reduce(Register const value) const noexcept { return Operations::reduce_min(value); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return scalar_operations::min(left, right); }
+    };
+
+    struct max_operation
+    {
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const left, Register const right) const noexcept { return Operations::max(left, right); }
+
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto reduce(Register const value) const noexcept { return Operations::reduce_max(value); }
+
+        template <typename Type>
+        [[nodiscard]] constexpr Type scalar(Type const left, Type const right) const noexcept { return scalar_operations::max(left, right); }
+    };
+
+    template <typename Type>
+    struct clamp_operation
+    {
+        Type low;
+        Type high;
+
+        template <typename Operations, typename Register>
+        [[nodiscard]] auto vector(Register const value) const noexcept
+        {
+            return Operations::min(Operations::max(value, Operations::broadcast(low)), Operations::broadcast(high));
+        }
+
+        [[nodiscard]] constexpr Type scalar(Type const value) const noexcept { return scalar_operations::min(scalar_operations::max(value, low), high); }
+    };
+
+    /*!
+     * @brief output[i] = operation(inputs[i]...) for every i in [0, size), through the vector registers where there is a
+     *        vector implementation for Type, with a scalar loop for the remaining elements.
+     */
+    template <typename Type, typename Operation, typename ...Inputs>
+    void transform(size_t const size, Type *const output, Operation const &operation, Inputs const *const ...inputs) noexcept
+    {
+        auto index = size_t{ 0 };
+        if constexpr (vector_operations<Type>::enabled)
+        {
+            using operations = vector_operations<Type>;
+            for (; index + operations::width <= size; index += operations::width)
+                operations::store(output + index, operation.template vector<operations>(operations::load(inputs + index)...));
+        }
+
+        for (; index < size; ++index)
+            output[index] = operation.scalar(inputs[index]...);
+    }
+
+    /*!
+     * @brief Folds values[0, size) with operation, starting from initial; the vector implementation keeps one partial
+     *        result per lane and folds the lanes at the end, so the order of the operations differs from the scalar loop.
+     */
+    template <typename Type, typename Operation>
+    [[nodiscard]] Type reduce(size_t const size, Type const *const values, Type initial, Operation const &operation) noexcept
+    {
+        auto index = size_t{ 0 };
+        if constexpr (vector_operations<Type>::enabled)
+        {
+            using operations = vector_operations<Type>;
+            if (size >= operations::width)
+            {
+                auto partial = operations::broadcast(initial);
+                for (; index + operations::width <= size; index += operations::width)
+                    partial = operation.template vector<operations>(partial, operations::load(values + index));
+
+                initial = operation.template reduce<operations>(partial);
+            }
+        }
+
+        for (; index < size; ++index)
+            initial = operation.scalar(initial, values[index]);
+
+        return initial;
+    }
+}
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef PITYPELISTS_TD_TYPE_ID_HXX
+#define PITYPELISTS_TD_TYPE_ID_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <tl_type_name.hxx>
+
+namespace pi::td
+{
+    template <typename Type, typename Tag, typename ...Policies>
+    struct typedecl;
+
+    /*! A string literal that can be a template argument: tag<"position.x">. */
+    template <size_t Size>
+    struct fixed_string
+    {
+        char text[Size]{};
+
+        consteval fixed_string(char const (&literal)[Size]) // NOLINT(google-explicit-constructor)
+        {
+            for (auto index = size_t{ 0 }; index < Size; ++index)
+                text[index] = literal[index];
+        }
+
+        [[nodiscard]] std::string_view constexpr view() const noexcept
+        {
+            return { text, Size - 1U };
+        }
+    };
+
+    /*! A tag named by a string: the same type, with the same ID, in every translation unit and with every compiler. */
+    template <fixed_string Name>
+    struct tag
+    {
+        std::string_view static constexpr name = Name.view();
+    };
+
+    /*!
+     * @brief A 64-bit ID of Type, usable as a switch label or as a key: the FNV-1a hash of its name.
+     * The name of a tag<"name"> is the given string; the ID of a typedecl combines the IDs of its type and of its tag (the
+     * policies do not change it). The name of other types is spelled by the compiler, so their ID is stable between
+     * builds by the same compiler only; specialize type_id to give them a name of their own. The tags of AUTO_TAG are named
+     * after the path of the file and the line: the ID of their typedecls is not a persistent key.
+     */
+    template <typename Type>
+    struct type_id
+    {
+        uint64_t static constexpr value = tl::internal::fnv1a(tl::internal::type_name<Type>());
+    };
+
+    template <fixed_string Name>
+    struct type_id<tag<Name>>
+    {
+        uint64_t static constexpr value = tl::internal::fnv1a(Name.view());
+    };
+
+    template <typename Type, typename Tag, typename ...Policies>
+    struct type_id<typedecl<Type, Tag, Policies...>>
+    {
+        uint64_t static constexpr value = tl::internal::fnv1a(type_id<Tag>::value, type_id<Type>::value);
+    };
+
+    template <typename Type>
+    uint64_t constexpr type_id_v = type_id<Type>::value;
+}
+
+#endif //PITYPELISTS_TD_TYPE_ID_HXX
@@ -1,35 +1,40 @@
 #ifndef PITYPELISTS_TD_TYPEDECL_BASE_HXX
 #define PITYPELISTS_TD_TYPEDECL_BASE_HXX
 
+#include <type_traits>
+#include <utility>
+
 namespace pi::td::internal
 {
     template <typename Type, typename Tag>
     struct wrapper_for_final
     {
-        constexpr wrapper_for_final() noexcept = default;
+        // The special members are defaulted without an exception specification, so that they are noexcept and trivial
+        // exactly when those of Type are.
+        constexpr wrapper_for_final() = default;
 
-        constexpr wrapper_for_final(wrapper_for_final &&)  noexcept = default;
-        constexpr wrapper_for_final(wrapper_for_final const &) noexcept = default;
+        constexpr wrapper_for_final(wrapper_for_final &&) = default;
+        constexpr wrapper_for_final(wrapper_for_final const &) = default;
 
-        constexpr explicit wrapper_for_final(Type &&data) noexcept
+        constexpr explicit wrapper_for_final(Type &&data) noexcept(std::is_nothrow_move_constructible_v<Type>)
         : data_{ std::forward<Type>(data) }
         {
         }
 
-        constexpr explicit wrapper_for_final(Type const &data) noexcept
+        constexpr explicit wrapper_for_final(Type const &data) noexcept(std::is_nothrow_copy_constructible_v<Type>)
                 : data_{ data }
         {
         }
 
-        wrapper_for_final &operator =(wrapper_for_final &&) noexcept = default;
-        wrapper_for_final &operator =(wrapper_for_final const &) noexcept = default;
+        constexpr wrapper_for_final &operator =(wrapper_for_final &&) = default;
+        constexpr wrapper_for_final &operator =(wrapper_for_final const &) = default;
 
-        std::add_lvalue_reference_t<std::add_const_t<Type>> operator *() const
+        constexpr std::add_lvalue_reference_t<std::add_const_t<Type>> operator *() const noexcept
         {
             return data_;
         }
 
-        std::add_pointer_t<std::add_const_t<Type>> operator ->() const
+        constexpr std::add_pointer_t<std::add_const_t<Type>> operator ->() const noexcept
         {
             return &data_;
         }
@@ -50,8 +55,11 @@ namespace pi::td::internal
         {
         }
 
+        constexpr wrapper_for_fundamental &operator =(wrapper_for_fundamental &&) noexcept = default;
+        constexpr wrapper_for_fundamental &operator =(wrapper_for_fundamental const &) noexcept = default;
+
         template <typename FromType, typename FromTag>
-        wrapper_for_fundamental &operator =(wrapper_for_fundamental<FromType, FromTag> &&other) noexcept
+        constexpr wrapper_for_fundamental &operator =(wrapper_for_fundamental<FromType, FromTag> &&other) noexcept
         {
             static_assert(std::is_same_v<FromType, Type> && std::is_same_v<FromTag, Tag>, "You cannot implicitly convert between strong types.");
 
@@ -60,7 +68,7 @@ namespace pi::td::internal
         }
 
         template <typename FromType, typename FromTag>
-        wrapper_for_fundamental &operator =(wrapper_for_fundamental<FromType, FromTag> const &other) noexcept
+        constexpr wrapper_for_fundamental &operator =(wrapper_for_fundamental<FromType, FromTag> const &other) noexcept
         {
             static_assert(std::is_same_v<FromType, Type> && std::is_same_v<FromTag, Tag>, "You cannot implicitly convert between strong types.");
 
@@ -68,20 +76,18 @@ namespace pi::td::internal
             return *this;
         }
 
-        wrapper_for_fundamental &operator =(Type &&value) noexcept
+        constexpr wrapper_for_fundamental &operator =(Type &&value) noexcept
         {
             data_ = std::forward<Type>(value);
             return *this;
         }
 
-        wrapper_for_fundamental &operator =(Type const &value) noexcept
+        constexpr wrapper_for_fundamental &operator =(Type const &value) noexcept
         {
             data_ = value;
             return *this;
         }
 
-        ~wrapper_for_fundamental() = default;
-
         constexpr operator Type() const noexcept // NOLINT(google-explicit-constructor)
         {
             return data_;
@@ -98,7 +104,7 @@ namespace pi::td::internal
         using Type::operator =;
 
         template <typename FromType, typename FromTag>
-        derived_from &operator =(derived_from<FromType, FromTag> &&other) noexcept
+        constexpr derived_from &operator =(derived_from<FromType, FromTag> &&other) noexcept(std::is_nothrow_move_assignable_v<Type>)
         {
             static_assert(std::is_same_v<FromType, Type> && std::is_same_v<FromTag, Tag>, "You cannot implicitly convert between strong types.");
 
@@ -107,7 +113,7 @@ namespace pi::td::internal
         }
 
         template <typename FromType, typename FromTag>
-        derived_from &operator =(derived_from<FromType, FromTag> const &other) noexcept
+        constexpr derived_from &operator =(derived_from<FromType, FromTag> const &other) noexcept(std::is_nothrow_copy_assignable_v<Type>)
         {
             static_assert(std::is_same_v<FromType, Type> && std::is_same_v<FromTag, Tag>, "You cannot implicitly convert between strong types.");
 
@@ -115,7 +121,7 @@ namespace pi::td::internal
             return *this;
         }
 
-        operator Type() const noexcept // NOLINT(google-explicit-constructor)
+        constexpr operator Type() const noexcept(std::is_nothrow_copy_constructible_v<Type>) // NOLINT(google-explicit-constructor)
         {
             return *this;
         }
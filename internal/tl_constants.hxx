@@ -5,7 +5,7 @@
 
 namespace pi::tl
 {
-    int64_t static constexpr npos = -1;
+    int64_t inline constexpr npos = -1;
 }
 
 #endif
@@ -1,18 +1,18 @@
 #ifndef PITYPELISTS_TL_COUNT_HXX
 #define PITYPELISTS_TL_COUNT_HXX
 
+#include <tl_match_table.hxx>
+
 namespace pi::tl::internal
 {
-    template <typename SearchedType>
+    template <typename SearchedType, typename ...TypeList>
     auto consteval count()
     {
-        return 0ULL;
-    }
+        auto result = size_t{ 0 };
+        for (auto const is_match : match_table<SearchedType, TypeList...>)
+            result += static_cast<size_t>(is_match);
 
-    template<typename SearchedType, typename Head, typename ...Tail>
-    auto consteval count()
-    {
-        return (static_cast<size_t>(std::is_same_v<SearchedType, Head>) + ... + static_cast<size_t>(std::is_same_v<SearchedType, Tail>));
+        return result;
     }
 }
 
@@ -0,0 +1,130 @@
+#ifndef PITYPELISTS_TL_FIELD_INITIALIZER_HXX
+#define PITYPELISTS_TL_FIELD_INITIALIZER_HXX
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <tl_constants.hxx>
+#include <tl_count.hxx>
+#include <tl_find.hxx>
+#include <tl_get.hxx>
+#include <tl_indexed.hxx>
+#include <tl_match_table.hxx>
+#include <tl_typelist.hxx>
+
+namespace pi::tl
+{
+    /*!
+     * @brief A default built by calling factory, only when it is needed: field<name_t, lazy{ [] { return name_t{ "x" }; } }>.
+     * A default that is not wrapped in lazy is always a value the field is constructed from, even a function object (e.g.
+     * the default of a std::function field).
+     */
+    template <typename Factory>
+    struct lazy
+    {
+        Factory factory;
+    };
+
+    template <typename Factory>
+    lazy(Factory) -> lazy<Factory>;
+}
+
+namespace pi::tl::internal
+{
+    template <typename Type>
+    bool constexpr is_lazy_v = false;
+
+    template <typename Factory>
+    bool constexpr is_lazy_v<lazy<Factory>> = true;
+
+    /*!
+     * @brief Converts to Field by constructing it from the referenced argument.
+     * @note Used to initialize a field of a struct: the Field is constructed in place, from the conversion result.
+     */
+    template <typename Field, typename Argument>
+    struct field_initializer
+    {
+        Argument &&argument;
+
+        constexpr operator Field() const // NOLINT(google-explicit-constructor)
+        {
+            return Field(std::forward<Argument>(argument));
+        }
+    };
+
+    /*! Converts to a value-initialized Field. */
+    template <typename Field>
+    struct value_initializer
+    {
+        constexpr operator Field() const // NOLINT(google-explicit-constructor)
+        {
+            return Field();
+        }
+    };
+
+    /*! The default of a field that is value-initialized. */
+    struct value_initialized {};
+
+    /*!
+     * @brief Converts to a Field constructed from Default, or from the result of its factory when Default is a lazy, which
+     *        is only called then; to a value-initialized Field when Default is value_initialized.
+     */
+    template <typename Field, auto Default>
+    struct default_initializer
+    {
+        constexpr operator Field() const // NOLINT(google-explicit-constructor)
+        {
+            using default_t = std::remove_cv_t<decltype(Default)>;
+            if constexpr (std::is_same_v<default_t, value_initialized>)
+                return Field();
+            else if constexpr (is_lazy_v<default_t>)
+            {
+                static_assert(std::is_constructible_v<Field, std::invoke_result_t<decltype(Default.factory) const &>>,
+                              "The factory of a lazy default must return a value the field can be constructed from.");
+                return Field(std::invoke(Default.factory));
+            }
+            else
+                return Field(Default);
+        }
+    };
+
+    /*! The number of elements of TypeList, before the one at Index, that are the same type as SearchedType. */
+    template <typename SearchedType, size_t Index, typename ...TypeList>
+    auto consteval rank_of()
+    {
+        auto rank = size_t{ 0 };
+        for (auto index = size_t{ 0 }; index < Index; ++index)
+            rank += static_cast<size_t>(match_table<SearchedType, TypeList...>[index]);
+
+        return rank;
+    }
+
+    /*!
+     * @brief The initializer of the field at Index in TypeList: the nth field of a type is initialized from the nth
+     *        argument of that type (relaxed matching), or value-initialized when there is no such argument.
+     * When there are more arguments of a type than fields, the last ones are used, so a later argument overrides an
+     * earlier one: struct_t<x_t>{ x_t{ 1.0 }, x_t{ 2.0 } } holds 2.0.
+     */
+    template <size_t Index, typename ...TypeList, typename ...Arguments>
+    [[nodiscard]] auto constexpr initializer_for(typelist<TypeList...>, [[maybe_unused]] Arguments &&...arguments)
+    {
+        using field_t = type_at_t<Index, TypeList...>;
+        auto constexpr number_of_fields = count<std::decay_t<field_t>, std::decay_t<TypeList>...>();
+        auto constexpr number_of_arguments = count<std::decay_t<field_t>, std::decay_t<Arguments>...>();
+        auto constexpr overridden = number_of_arguments > number_of_fields ? number_of_arguments - number_of_fields : size_t{ 0 };
+        auto constexpr rank = rank_of<std::decay_t<field_t>, Index, std::decay_t<TypeList>...>();
+        auto constexpr argument_index = find<std::decay_t<field_t>, overridden + rank + 1U, std::decay_t<Arguments>...>();
+
+        if constexpr (argument_index == npos)
+            return value_initializer<field_t>{};
+        else
+        {
+            using argument_t = type_at_t<argument_index, Arguments...>;
+            return field_initializer<field_t, argument_t>{ internal::get<argument_index, Arguments...>(std::forward<Arguments>(arguments)...) };
+        }
+    }
+}
+
+#endif
@@ -4,42 +4,20 @@
 #include <type_traits>
 
 #include <tl_constants.hxx>
-#include <tl_count.hxx>
+#include <tl_match_table.hxx>
 
 namespace pi::tl::internal
 {
-    template <typename SearchedType, size_t Nth>
-    auto consteval find_no_assert()
-    {
-        return int64_t{ 0 };
-    }
-
-    template <typename SearchedType, size_t Nth, typename Head, typename ...Tail>
-    auto consteval find_no_assert()
-    {
-        if constexpr (count<SearchedType, Head, Tail...>() < Nth)
-            return npos;
-
-        if constexpr (std::is_same_v<SearchedType, Head>)
-        {
-            if constexpr (Nth == 1U)
-                return int64_t{ 0 };
-            else
-                return int64_t{ 1 } + find_no_assert<SearchedType, Nth - 1U, Tail...>();
-        }
-        else
-            return int64_t{ 1 } + find_no_assert<SearchedType, Nth, Tail...>();
-    }
-
     template <typename SearchedType, size_t Nth, typename ...TypeList>
     auto consteval find()
     {
         static_assert(Nth > 0U, "Nth is a 1-based index representing which 'instance' of SearchedType you want to search for.");
 
-        if constexpr (sizeof...(TypeList) == 0ULL)
-            return npos;
+        auto constexpr &positions = position_table<SearchedType, TypeList...>;
+        if constexpr (Nth <= positions.size())
+            return static_cast<int64_t>(positions[Nth - 1U]);
         else
-            return find_no_assert<SearchedType, Nth, TypeList...>();
+            return npos;
     }
 }
 
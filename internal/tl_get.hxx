@@ -1,50 +1,79 @@
 #ifndef PITYPELISTS_TL_GET_HXX
 #define PITYPELISTS_TL_GET_HXX
 
+#include <functional>
+#include <stdexcept>
 #include <tuple>
+#include <variant>
 
 #include <tl_count.hxx>
 #include <tl_find.hxx>
+#include <tl_indexed.hxx>
+#include <tl_jump_table.hxx>
 
 namespace pi::tl::internal
 {
-    template<size_t Index, typename Head, typename ...Tail>
-    [[nodiscard]] decltype(auto) constexpr get_no_assert(Head &&first, [[maybe_unused]] Tail &&...rest)
-    {
-        if constexpr (Index == 0)
-            return std::forward<Head>(first);
-        else
-            return get_no_assert<Index - 1U, Tail...>(std::forward<Tail>(rest)...);
-    }
-
     template<size_t Index, typename ...TypeList>
     [[nodiscard]] decltype(auto) constexpr get(TypeList &&...arguments)
     {
         static_assert(Index < sizeof...(TypeList), "Index out of bounds.");
 
-        return get_no_assert<Index, TypeList...>(std::forward<TypeList>(arguments)...);
+        return get_reference<Index>(indexed_references<TypeList...>{ { std::forward<TypeList>(arguments) }... });
     }
 
     template <typename Type>
-    [[nodiscard, maybe_unused]] decltype(auto) constexpr get_no_throw(size_t const, Type &&argument)
+    struct selection
     {
-        return std::forward<Type>(argument);
-    }
+        using type = Type;
+    };
+
+    template <typename Left, typename Right>
+    auto operator |(selection<Left>, selection<Right>) -> selection<decltype(true ? std::declval<Left>() : std::declval<Right>())>;
 
-    template <typename Head, typename ...TypeList>
-    [[nodiscard]] decltype(auto) constexpr get_no_throw(size_t const index, Head &&first, TypeList &&...rest)
+    /*!
+     * @brief The type of (index == 0 ? argument0 : index == 1 ? argument1 : ...), computed with a fold expression, so
+     *        the instantiation depth does not grow with the number of arguments.
+     */
+    template <typename ...TypeList>
+    using get_result_t = typename decltype((selection<TypeList &&>{} | ...))::type;
+
+    template<typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get(size_t const index, TypeList &&...arguments)
     {
-        return index == 0ULL ? std::forward<Head>(first)
-                             : get_no_throw(index - 1ULL, std::forward<TypeList>(rest)...);
+        if (index >= sizeof...(TypeList))
+            throw std::out_of_range("Index out of bounds");
+
+        using result_t = get_result_t<TypeList...>;
+        return visit_no_throw<result_t>(
+                index
+              , [](auto, auto &&argument) -> result_t { return std::forward<decltype(argument)>(argument); }
+              , std::forward<TypeList>(arguments)...);
     }
 
     template<typename ...TypeList>
-    [[nodiscard]] decltype(auto) constexpr get(size_t const index, TypeList &&...arguments)
+    [[nodiscard]] auto constexpr get_variant(size_t const index, TypeList &&...arguments)
     {
         if (index >= sizeof...(TypeList))
             throw std::out_of_range("Index out of bounds");
 
-        return get_no_throw<TypeList...>(index, std::forward<TypeList>(arguments)...);
+        using result_t = std::variant<std::remove_cvref_t<TypeList>...>;
+        return visit_no_throw<result_t>(
+                index
+              , [](auto nth, auto &&argument) { return result_t{ std::in_place_index<decltype(nth)::value>, std::forward<decltype(argument)>(argument) }; }
+              , std::forward<TypeList>(arguments)...);
+    }
+
+    template<typename Visitor, typename ...TypeList>
+    decltype(auto) constexpr visit_at(size_t const index, Visitor &&visitor, TypeList &&...arguments)
+    {
+        if (index >= sizeof...(TypeList))
+            throw std::out_of_range("Index out of bounds");
+
+        using result_t = std::common_type_t<std::invoke_result_t<Visitor, TypeList &&>...>;
+        return visit_no_throw<result_t>(
+                index
+              , [&visitor](auto, auto &&argument) -> result_t { return std::invoke(std::forward<Visitor>(visitor), std::forward<decltype(argument)>(argument)); }
+              , std::forward<TypeList>(arguments)...);
     }
 
     template<size_t Nth, typename SearchedType, typename ...TypeList>
@@ -62,35 +91,49 @@ namespace pi::tl::internal
         }
     }
 
-    template<typename SearchedType, typename Type>
-    [[nodiscard]] auto constexpr get_or_initialize(size_t const nth, [[maybe_unused]] SearchedType default_value, [[maybe_unused]] Type &&argument)
+    template<int64_t Index, typename Factory, typename ...TypeList>
+    [[nodiscard]] decltype(auto) constexpr get_or_invoke([[maybe_unused]] Factory &&factory, [[maybe_unused]] TypeList &&...arguments)
     {
-        if constexpr (!std::is_same_v<Type, SearchedType>)
-            return default_value;
-        else
-        {
-            if (nth != 1ULL)
-                return default_value;
-
-            return std::forward<Type>(argument);
-        }
+        if constexpr (Index == npos)
+            return std::invoke(std::forward<Factory>(factory));
+        else if constexpr (std::is_lvalue_reference_v<type_at_t<static_cast<size_t>(Index), TypeList...>>)
+            return get<static_cast<size_t>(Index), TypeList...>(std::forward<TypeList>(arguments)...);
+        else // an rvalue is moved into the result, a reference to it would outlive the caller's temporary
+            return std::remove_cvref_t<type_at_t<static_cast<size_t>(Index), TypeList...>>(get<static_cast<size_t>(Index), TypeList...>(std::forward<TypeList>(arguments)...));
     }
 
-    template<typename SearchedType, typename Head, typename ...TypeList>
-    [[nodiscard]] auto constexpr get_or_initialize(size_t const nth, SearchedType default_value, Head &&first, [[maybe_unused]] TypeList &&...rest)
+    template<typename SearchedType, size_t ...Positions, typename ...TypeList>
+    [[nodiscard]] auto constexpr get_or_initialize(std::index_sequence<Positions...>, size_t const nth, SearchedType default_value, [[maybe_unused]] TypeList &&...arguments)
     {
-        if (nth > count<SearchedType, Head, TypeList...>())
-            return default_value;
-
-        if constexpr (std::is_same_v<Head, SearchedType>)
+        using result_t = std::decay_t<SearchedType>;
+        if constexpr (sizeof...(Positions) == 0ULL)
+            return result_t(default_value);
+        else
         {
-            if (nth == 1ULL)
-                return std::forward<Head>(first);
-
-            return get_or_initialize<SearchedType, TypeList...>(nth - 1ULL, std::forward<SearchedType>(default_value), std::forward<TypeList>(rest)...);
+            if (nth == 0ULL || nth > sizeof...(Positions))
+                return result_t(default_value);
+
+            using first_argument_t = type_at_t<0U, type_at_t<Positions, TypeList...>...>;
+            if constexpr ((std::is_same_v<type_at_t<Positions, TypeList...>, first_argument_t> && ...))
+            {
+                // All the matching arguments have the same type: one comparison of nth per matching argument (not per
+                // argument), against constants, which the compiler can lower to a single indexed jump.
+                auto const references = indexed_references<TypeList...>{ { std::forward<TypeList>(arguments) }... };
+                auto constexpr positions = std::array<size_t, sizeof...(Positions)>{ Positions... };
+                std::remove_reference_t<first_argument_t> *address = nullptr;
+                [&]<size_t ...Ranks>(std::index_sequence<Ranks...>)
+                {
+                    static_cast<void>(((nth == Ranks + 1ULL && (address = get_address<positions[Ranks]>(references), true)) || ...));
+                }(std::make_index_sequence<sizeof...(Positions)>{});
+
+                return result_t(std::forward<first_argument_t>(*address));
+            }
+            else
+                return visit_selected_no_throw<result_t, std::index_sequence<Positions...>>(
+                        nth - 1ULL
+                      , [](auto, auto &&argument) { return result_t(std::forward<decltype(argument)>(argument)); }
+                      , std::forward<TypeList>(arguments)...);
         }
-        else
-            return get_or_initialize<SearchedType, TypeList...>(nth, std::forward<SearchedType>(default_value), std::forward<TypeList>(rest)...);
     }
 }
 
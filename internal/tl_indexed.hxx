@@ -0,0 +1,84 @@
+#ifndef PITYPELISTS_TL_INDEXED_HXX
+#define PITYPELISTS_TL_INDEXED_HXX
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pi::tl::internal
+{
+    template <size_t Index, typename Type>
+    struct indexed_type
+    {
+        using type = Type;
+    };
+
+    template <typename Indices, typename ...TypeList>
+    struct indexed_types_base;
+
+    template <size_t ...Indices, typename ...TypeList>
+    struct indexed_types_base<std::index_sequence<Indices...>, TypeList...>
+        : indexed_type<Indices, TypeList>...
+    {
+    };
+
+    template <typename ...TypeList>
+    using indexed_types = indexed_types_base<std::index_sequence_for<TypeList...>, TypeList...>;
+
+    template <size_t Index, typename Type>
+    auto select_indexed_type(indexed_type<Index, Type> const &) -> indexed_type<Index, Type>;
+
+#if defined(__has_builtin)
+#if __has_builtin(__type_pack_element)
+#define PITYPELISTS_HAS_TYPE_PACK_ELEMENT
+#endif
+#endif
+
+    /*!
+     * @brief The type at Index in TypeList, selected by overload resolution against the (flat) bases of indexed_types,
+     *        or by the pack indexing builtin of the compiler, where there is one (it does not scan TypeList).
+     * @note The instantiation depth does not grow with the size of TypeList.
+     */
+    template <size_t Index, typename ...TypeList>
+#if defined(PITYPELISTS_HAS_TYPE_PACK_ELEMENT)
+    using type_at_t = __type_pack_element<Index, TypeList...>;
+#else
+    using type_at_t = typename decltype(select_indexed_type<Index>(std::declval<indexed_types<TypeList...>>()))::type;
+#endif
+
+    template <size_t Index, typename Type>
+    struct indexed_reference
+    {
+        Type &&reference;
+    };
+
+    template <typename Indices, typename ...TypeList>
+    struct indexed_references_base;
+
+    template <size_t ...Indices, typename ...TypeList>
+    struct indexed_references_base<std::index_sequence<Indices...>, TypeList...>
+        : indexed_reference<Indices, TypeList>...
+    {
+    };
+
+    /*!
+     * @brief Flat (non-recursive, unlike std::tuple) aggregate of references to the arguments, one base per argument.
+     * @note The instantiation depth does not grow with the number of arguments.
+     */
+    template <typename ...TypeList>
+    using indexed_references = indexed_references_base<std::index_sequence_for<TypeList...>, TypeList...>;
+
+    template <size_t Index, typename Type>
+    [[nodiscard]] Type constexpr &&get_reference(indexed_reference<Index, Type> const &argument)
+    {
+        return std::forward<Type>(argument.reference);
+    }
+
+    template <size_t Index, typename Type>
+    [[nodiscard]] std::remove_reference_t<Type> constexpr *get_address(indexed_reference<Index, Type> const &argument)
+    {
+        return &argument.reference;
+    }
+}
+
+#endif
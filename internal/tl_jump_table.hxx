@@ -0,0 +1,57 @@
+#ifndef PITYPELISTS_TL_JUMP_TABLE_HXX
+#define PITYPELISTS_TL_JUMP_TABLE_HXX
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <tl_indexed.hxx>
+
+namespace pi::tl::internal
+{
+    template <typename Result, size_t Index, typename Visitor, typename Arguments>
+    [[nodiscard]] Result constexpr visit_one(Visitor &&visitor, Arguments const &arguments)
+    {
+        return std::forward<Visitor>(visitor)(std::integral_constant<size_t, Index>{}, get_reference<Index>(arguments));
+    }
+
+    template <typename Result, typename Visitor, typename Arguments, size_t ...Indices>
+    [[nodiscard]] auto consteval make_jump_table(std::index_sequence<Indices...>)
+    {
+        return std::array<Result (*)(Visitor &&, Arguments const &), sizeof...(Indices)>{ &visit_one<Result, Indices, Visitor, Arguments>... };
+    }
+
+    /*!
+     * @brief One thunk per index in Indices; the thunk at position K calls the visitor with
+     *        std::integral_constant<size_t, I> and the Ith argument, where I is the Kth index in Indices.
+     * @note The table is built with a single pack expansion, so a lookup with a run-time index is one indexed indirect call.
+     */
+    template <typename Result, typename Visitor, typename Indices, typename ...TypeList>
+    auto constexpr jump_table = make_jump_table<Result, Visitor, indexed_references<TypeList...>>(Indices{});
+
+    /*!
+     * @brief Calls visitor(std::integral_constant<size_t, I>{}, argument at I) through the jump table, where I is the
+     *        element at the given position in Indices.
+     * @note There is no bounds check; position must be less than Indices::size().
+     */
+    template <typename Result, typename Indices, typename Visitor, typename ...TypeList>
+    [[nodiscard]] Result constexpr visit_selected_no_throw(size_t const position, Visitor &&visitor, TypeList &&...arguments)
+    {
+        return jump_table<Result, Visitor, Indices, TypeList...>[position](
+                std::forward<Visitor>(visitor)
+              , indexed_references<TypeList...>{ { std::forward<TypeList>(arguments) }... });
+    }
+
+    /*!
+     * @brief Calls visitor(std::integral_constant<size_t, index>{}, argument at index) through the jump table.
+     * @note There is no bounds check; index must be less than sizeof...(TypeList).
+     */
+    template <typename Result, typename Visitor, typename ...TypeList>
+    [[nodiscard]] Result constexpr visit_no_throw(size_t const index, Visitor &&visitor, TypeList &&...arguments)
+    {
+        return visit_selected_no_throw<Result, std::index_sequence_for<TypeList...>>(index, std::forward<Visitor>(visitor), std::forward<TypeList>(arguments)...);
+    }
+}
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef PITYPELISTS_TL_LAYOUT_HXX
+#define PITYPELISTS_TL_LAYOUT_HXX
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <tl_indexed.hxx>
+
+namespace pi::tl
+{
+    /*! The layout is used to select the order in which the fields of a struct are stored. */
+    enum class layout
+    {
+        declared /*! fields are stored where a std::tuple of them stores them: in the order they are declared in with
+                     libc++, in reverse with libstdc++ and the MSVC STL */
+      , packed   /*! fields are stored by decreasing alignment, then decreasing size, which minimizes the padding */
+    };
+}
+
+namespace pi::tl::internal
+{
+    /*! Whether std::tuple stores its elements last first, as libstdc++ and the MSVC STL do; libc++ stores them in order. */
+#if defined(_LIBCPP_VERSION)
+    bool inline constexpr tuple_stores_in_reverse = false;
+#else
+    bool inline constexpr tuple_stores_in_reverse = true;
+#endif
+
+    template <layout Layout, typename ...TypeList>
+    [[nodiscard]] auto consteval make_storage_order()
+    {
+        auto order = std::array<size_t, sizeof...(TypeList)>{};
+        for (auto index = size_t{ 0 }; index < order.size(); ++index)
+            order[index] = Layout == layout::declared && tuple_stores_in_reverse ? order.size() - 1U - index : index;
+
+        if constexpr (Layout == layout::packed)
+        {
+            auto constexpr alignments = std::array<size_t, sizeof...(TypeList)>{ alignof(TypeList)... };
+            auto constexpr sizes = std::array<size_t, sizeof...(TypeList)>{ sizeof(TypeList)... };
+            auto const goes_before = [&](size_t const left, size_t const right)
+            {
+                if (alignments[left] != alignments[right])
+                    return alignments[left] > alignments[right];
+                if (sizes[left] != sizes[right])
+                    return sizes[left] > sizes[right];
+                return left < right;
+            };
+
+            // insertion sort: stable, constexpr and fast enough for the number of fields of a struct
+            for (auto index = size_t{ 1 }; index < order.size(); ++index)
+            {
+                auto const field = order[index];
+                auto slot = index;
+                for (; slot > 0U && goes_before(field, order[slot - 1U]); --slot)
+                    order[slot] = order[slot - 1U];
+                order[slot] = field;
+            }
+        }
+
+        return order;
+    }
+
+    /*! The index, in TypeList, of the field stored in each slot. */
+    template <layout Layout, typename ...TypeList>
+    auto constexpr storage_order = make_storage_order<Layout, TypeList...>();
+
+    template <layout Layout, typename ...TypeList>
+    [[nodiscard]] auto consteval make_storage_slots()
+    {
+        auto slots = std::array<size_t, sizeof...(TypeList)>{};
+        for (auto slot = size_t{ 0 }; slot < slots.size(); ++slot)
+            slots[storage_order<Layout, TypeList...>[slot]] = slot;
+
+        return slots;
+    }
+
+    /*! The slot in which each field of TypeList is stored; the inverse of storage_order. */
+    template <layout Layout, typename ...TypeList>
+    auto constexpr storage_slots = make_storage_slots<Layout, TypeList...>();
+
+    /*! Selects the constructor of a struct that takes one argument per field, in the order the fields are declared in. */
+    struct in_declared_order_t {};
+    in_declared_order_t inline constexpr in_declared_order{};
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define PITYPELISTS_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define PITYPELISTS_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+    /*! The field stored in Slot; an empty field takes no room. */
+    template <size_t Slot, typename Type>
+    struct storage_leaf
+    {
+        PITYPELISTS_NO_UNIQUE_ADDRESS Type value{};
+    };
+
+    template <typename Slots, typename ...Fields>
+    struct storage_base;
+
+    template <size_t ...Slots, typename ...Fields>
+    struct storage_base<std::index_sequence<Slots...>, Fields...>
+        : storage_leaf<Slots, Fields>...
+    {
+        storage_base() = default;
+
+        /*! Constructs the field in each slot from the argument at the same position. */
+        template <typename ...Arguments>
+        constexpr explicit storage_base(std::in_place_t, Arguments &&...arguments)
+            : storage_leaf<Slots, Fields>{ std::forward<Arguments>(arguments) }...
+        {
+        }
+    };
+
+    template <layout Layout, typename ...TypeList>
+    struct storage
+    {
+        template <size_t ...Slots>
+        static auto from(std::index_sequence<Slots...>) -> storage_base<std::index_sequence<Slots...>, type_at_t<storage_order<Layout, TypeList...>[Slots], TypeList...>...>;
+    };
+
+    /*!
+     * @brief The fields of TypeList, in the order given by Layout: one base per field, keyed by its slot.
+     * @note Flat (non-recursive, unlike std::tuple): the instantiation depth does not grow with the number of fields.
+     */
+    template <layout Layout, typename ...TypeList>
+    using storage_t = decltype(storage<Layout, TypeList...>::from(std::index_sequence_for<TypeList...>{}));
+
+    /*! The field in Slot, selected by overload resolution against the bases of storage_t: it does not scan the fields. */
+    template <size_t Slot, typename Type>
+    [[nodiscard]] Type constexpr &get_field(storage_leaf<Slot, Type> &leaf) noexcept
+    {
+        return leaf.value;
+    }
+
+    template <size_t Slot, typename Type>
+    [[nodiscard]] Type const constexpr &get_field(storage_leaf<Slot, Type> const &leaf) noexcept
+    {
+        return leaf.value;
+    }
+
+    /*! The field at Slot of a tuple_storage_t that is a std::tuple: its slots are the indices of the tuple. */
+    template <size_t Slot, typename ...Fields>
+    [[nodiscard]] auto constexpr get_field(std::tuple<Fields...> &tuple) noexcept -> type_at_t<Slot, Fields...> &
+    {
+        return std::get<Slot>(tuple);
+    }
+
+    template <size_t Slot, typename ...Fields>
+    [[nodiscard]] auto constexpr get_field(std::tuple<Fields...> const &tuple) noexcept -> type_at_t<Slot, Fields...> const &
+    {
+        return std::get<Slot>(tuple);
+    }
+
+    /*! Whether each field of left equals the field in the same slot of right. */
+    template <size_t ...Slots, typename ...Fields>
+    [[nodiscard]] bool constexpr equal_fields(storage_base<std::index_sequence<Slots...>, Fields...> const &left,
+                                              storage_base<std::index_sequence<Slots...>, Fields...> const &right)
+    {
+        return ((get_field<Slots>(left) == get_field<Slots>(right)) && ...);
+    }
+
+    template <typename ...Fields>
+    [[nodiscard]] bool constexpr equal_fields(std::tuple<Fields...> const &left, std::tuple<Fields...> const &right)
+    {
+        return left == right;
+    }
+
+    /*!
+     * @brief The storage of a struct with constants. With the declared layout, it is the std::tuple of the fields it has
+     *        always derived from, so that it is still a std::tuple (std::get, std::apply, conversion to a reference to
+     *        it); otherwise, it is storage_t.
+     */
+    template <layout Layout, typename ...TypeList>
+    using tuple_storage_t = std::conditional_t<Layout == layout::declared, std::tuple<TypeList...>, storage_t<Layout, TypeList...>>;
+
+    template <layout Layout, typename ...TypeList>
+    [[nodiscard]] auto consteval make_tuple_storage_slots()
+    {
+        if constexpr (Layout == layout::declared)
+        {
+            auto slots = std::array<size_t, sizeof...(TypeList)>{};
+            for (auto index = size_t{ 0 }; index < slots.size(); ++index)
+                slots[index] = index;
+
+            return slots;
+        }
+        else
+            return storage_slots<Layout, TypeList...>;
+    }
+
+    /*! The slot in which each field of TypeList is stored in tuple_storage_t. */
+    template <layout Layout, typename ...TypeList>
+    auto constexpr tuple_storage_slots = make_tuple_storage_slots<Layout, TypeList...>();
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef PITYPELISTS_TL_MATCH_TABLE_HXX
+#define PITYPELISTS_TL_MATCH_TABLE_HXX
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace pi::tl::internal
+{
+    /*!
+     * @brief One flag per element of TypeList, telling if that element is the same type as SearchedType.
+     * @note The table is built with a single pack expansion: no recursion, so the instantiation depth does not grow with
+     *       the size of TypeList and the table is shared by every query for the same SearchedType and TypeList.
+     */
+    template <typename SearchedType, typename ...TypeList>
+    std::array<bool, sizeof...(TypeList)> inline constexpr match_table{ std::is_same_v<SearchedType, TypeList>... };
+
+    template <typename SearchedType, typename ...TypeList>
+    auto consteval make_position_table()
+    {
+        std::array<size_t, (size_t{ 0 } + ... + static_cast<size_t>(std::is_same_v<SearchedType, TypeList>))> positions{};
+        auto found = size_t{ 0 };
+        for (auto index = size_t{ 0 }; index < match_table<SearchedType, TypeList...>.size(); ++index)
+        {
+            if (match_table<SearchedType, TypeList...>[index])
+                positions[found++] = index;
+        }
+
+        return positions;
+    }
+
+    /*!
+     * @brief The 0-based indices of the elements of TypeList that are the same type as SearchedType, in increasing order.
+     * @note Built once per SearchedType and TypeList; counting is reading its size, finding the nth is reading an element.
+     */
+    template <typename SearchedType, typename ...TypeList>
+    auto inline constexpr position_table = make_position_table<SearchedType, TypeList...>();
+
+    template <typename SearchedType, typename ...TypeList>
+    struct position_sequence
+    {
+        template <size_t ...Positions>
+        static auto from(std::index_sequence<Positions...>) -> std::index_sequence<position_table<SearchedType, TypeList...>[Positions]...>;
+
+        using type = decltype(from(std::make_index_sequence<position_table<SearchedType, TypeList...>.size()>{}));
+    };
+
+    /*! The position table of SearchedType in TypeList, as a std::index_sequence. */
+    template <typename SearchedType, typename ...TypeList>
+    using position_sequence_t = typename position_sequence<SearchedType, TypeList...>::type;
+}
+
+#endif
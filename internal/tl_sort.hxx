@@ -0,0 +1,206 @@
+#ifndef PITYPELISTS_TL_SORT_HXX
+#define PITYPELISTS_TL_SORT_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include <tl_indexed.hxx>
+#include <tl_type_name.hxx>
+#include <tl_transform.hxx>
+#include <tl_typelist.hxx>
+
+namespace pi::tl::internal
+{
+    /*! Orders types by the hash of their name, then by their name: the same order in every translation unit. */
+    struct type_order_key
+    {
+        uint64_t hash;
+        std::string_view name;
+
+        [[nodiscard]] bool constexpr operator <(type_order_key const &other) const noexcept
+        {
+            return hash != other.hash ? hash < other.hash : name < other.name;
+        }
+
+        [[nodiscard]] bool constexpr operator ==(type_order_key const &other) const noexcept = default;
+    };
+
+    template <typename Type>
+    type_order_key inline constexpr order_key_of{ fnv1a(type_name<Type>()), type_name<Type>() };
+
+    /*! A distinct address for each type: tells apart the types that are spelled alike. */
+    template <typename Type>
+    char inline constexpr identity_of{};
+
+    template <typename List>
+    struct order_table;
+
+    /*!
+     * @brief The positions of the elements of TypeList sorted by their key (stably), and whether each sorted element has
+     *        the same key as the previous one.
+     * @note Computed by a constexpr merge sort of an array: the instantiation depth does not grow with the size of TypeList.
+     */
+    template <typename ...TypeList>
+    struct order_table<typelist<TypeList...>>
+    {
+        size_t static constexpr size = sizeof...(TypeList);
+
+        static constexpr std::array<type_order_key, size> keys{ order_key_of<TypeList>... };
+
+        static constexpr std::array<size_t, size> sorted = []
+        {
+            // Bottom-up merge sort: stable, and cheap enough for the constexpr evaluation limits at thousands of types.
+            // The work arrays are built-in ones: their subscripts are not function calls, which the compilers count.
+            uint64_t hashes[size + 1U]{ order_key_of<TypeList>.hash... }; // NOLINT(*-avoid-c-arrays)
+            size_t first[size + 1U]{}; // NOLINT(*-avoid-c-arrays)
+            size_t second[size + 1U]{}; // NOLINT(*-avoid-c-arrays)
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                first[index] = index;
+
+            // the names are compared only when the hashes are equal
+            auto const precedes = [&hashes](size_t const left, size_t const right)
+            {
+                return hashes[left] != hashes[right] ? hashes[left] < hashes[right] : keys[left].name < keys[right].name;
+            };
+
+            auto *positions = first;
+            auto *buffer = second;
+            for (auto width = size_t{ 1 }; width < size; width *= 2U)
+            {
+                for (auto begin = size_t{ 0 }; begin < size; begin += 2U * width)
+                {
+                    auto const middle = std::min(begin + width, size);
+                    auto const end = std::min(begin + 2U * width, size);
+                    auto left = begin;
+                    auto right = middle;
+                    auto out = begin;
+                    while (left < middle && right < end)
+                        buffer[out++] = precedes(positions[right], positions[left]) ? positions[right++] : positions[left++];
+                    while (left < middle)
+                        buffer[out++] = positions[left++];
+                    while (right < end)
+                        buffer[out++] = positions[right++];
+                }
+                std::swap(positions, buffer);
+            }
+
+            auto result = std::array<size_t, size>{};
+            std::copy_n(positions, size, result.begin());
+            return result;
+        }();
+
+        static constexpr std::array<bool, size> repeats = []
+        {
+            auto flags = std::array<bool, size>{};
+            for (auto index = size_t{ 1 }; index < size; ++index)
+                flags[index] = keys[sorted[index]] == keys[sorted[index - 1U]];
+            return flags;
+        }();
+
+        /*! Distinct types have distinct names, unless they are unnamed and spelled alike (e.g. closures). */
+        static constexpr bool have_distinct_names = []
+        {
+            char const *identities[size + 1U]{ &identity_of<TypeList>... }; // NOLINT(*-avoid-c-arrays)
+            for (auto index = size_t{ 1 }; index < size; ++index)
+                if (repeats[index] && identities[sorted[index]] != identities[sorted[index - 1U]])
+                    return false;
+            return true;
+        }();
+
+        static_assert(have_distinct_names, "Distinct types spelled alike (e.g. closures) cannot be ordered.");
+    };
+
+    /*! The position of the first instance of each distinct type of List, in increasing order. */
+    template <typename List>
+    auto consteval find_unique()
+    {
+        using table_t = order_table<List>;
+
+        // the sort is stable: the first of a run of equal keys is the first instance in List
+        auto is_first = std::array<bool, table_t::size>{};
+        for (auto index = size_t{ 0 }; index < table_t::size; ++index)
+            is_first[table_t::sorted[index]] = !table_t::repeats[index];
+
+        auto found = position_list<table_t::size>{};
+        for (auto index = size_t{ 0 }; index < table_t::size; ++index)
+            if (is_first[index])
+                found.push(index);
+
+        return found;
+    }
+
+    template <typename List>
+    auto consteval make_unique_positions()
+    {
+        auto constexpr found = find_unique<List>();
+        return found.template used<found.count>();
+    }
+
+    template <typename List>
+    auto inline constexpr unique_positions = make_unique_positions<List>();
+
+    /*! The position of the first instance of each distinct type of List, sorted by key. */
+    template <typename List>
+    auto consteval find_canonical()
+    {
+        using table_t = order_table<List>;
+        auto found = position_list<table_t::size>{};
+        for (auto index = size_t{ 0 }; index < table_t::size; ++index)
+            if (!table_t::repeats[index])
+                found.push(table_t::sorted[index]);
+
+        return found;
+    }
+
+    template <typename List>
+    auto consteval make_canonical_positions()
+    {
+        auto constexpr found = find_canonical<List>();
+        return found.template used<found.count>();
+    }
+
+    template <typename List>
+    auto inline constexpr canonical_positions = make_canonical_positions<List>();
+
+    /*! The canonical positions, in Left, of the types that are also in Right: a merge of the two sorted sets. */
+    template <typename Left, typename Right>
+    auto consteval find_intersection()
+    {
+        auto constexpr &left = canonical_positions<Left>;
+        auto constexpr &right = canonical_positions<Right>;
+        auto found = position_list<left.size()>{};
+        for (auto l = size_t{ 0 }, r = size_t{ 0 }; l < left.size() && r < right.size();)
+        {
+            auto const &left_key = order_table<Left>::keys[left[l]];
+            auto const &right_key = order_table<Right>::keys[right[r]];
+            if (left_key < right_key)
+                ++l;
+            else if (right_key < left_key)
+                ++r;
+            else
+            {
+                found.push(left[l]);
+                ++l;
+                ++r;
+            }
+        }
+
+        return found;
+    }
+
+    template <typename Left, typename Right>
+    auto consteval make_intersection_positions()
+    {
+        auto constexpr found = find_intersection<Left, Right>();
+        return found.template used<found.count>();
+    }
+
+    template <typename Left, typename Right>
+    auto inline constexpr intersection_positions = make_intersection_positions<Left, Right>();
+}
+
+#endif
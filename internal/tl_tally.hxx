@@ -0,0 +1,63 @@
+#ifndef PITYPELISTS_TL_TALLY_HXX
+#define PITYPELISTS_TL_TALLY_HXX
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include <tl_constants.hxx>
+#include <tl_match_table.hxx>
+#include <tl_matching_strategy.hxx>
+#include <tl_typelist.hxx>
+
+namespace pi::tl::internal
+{
+    template <size_t NumberOfSearchedTypes>
+    struct tally_t
+    {
+        std::array<size_t, NumberOfSearchedTypes> counts{};
+        std::array<int64_t, NumberOfSearchedTypes> first_positions{};
+        size_t unmatched{};
+    };
+
+    /*! Attributes the element at index to each searched type it matches (given by their positions), or to none. */
+    template <size_t NumberOfSearchedTypes, size_t NumberOfMatches>
+    void constexpr attribute(tally_t<NumberOfSearchedTypes> &result, std::array<size_t, NumberOfMatches> const &matches, size_t const index)
+    {
+        if constexpr (NumberOfMatches == 0U)
+            ++result.unmatched;
+
+        for (auto const match : matches)
+        {
+            if (result.counts[match]++ == 0U)
+                result.first_positions[match] = static_cast<int64_t>(index);
+        }
+    }
+
+    template <typename ...SearchedTypes, typename ...TypeList>
+    auto consteval make_tally(typelist<SearchedTypes...>, typelist<TypeList...>)
+    {
+        auto result = tally_t<sizeof...(SearchedTypes)>{};
+        result.first_positions.fill(npos);
+
+        auto index = size_t{ 0 };
+        (attribute(result, position_table<TypeList, SearchedTypes...>, index++), ...);
+        return result;
+    }
+
+    template <matching Strategy, typename SearchedList, typename ...TypeList>
+    struct tally;
+
+    /*!
+     * @brief Counts, first positions and the number of elements of TypeList matching none of SearchedTypes, in one pass.
+     * Each element of TypeList is attributed to every one of SearchedTypes it matches, respecting the matching Strategy, so
+     * that the count and the first position of each searched type are those of count and find.
+     */
+    template <matching Strategy, typename ...SearchedTypes, typename ...TypeList>
+    struct tally<Strategy, typelist<SearchedTypes...>, TypeList...>
+    {
+        static constexpr auto value = make_tally(typelist<apply_strategy_t<Strategy, SearchedTypes>...>{}, typelist<apply_strategy_t<Strategy, TypeList>...>{});
+    };
+}
+
+#endif
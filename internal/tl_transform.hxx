@@ -0,0 +1,128 @@
+#ifndef PITYPELISTS_TL_TRANSFORM_HXX
+#define PITYPELISTS_TL_TRANSFORM_HXX
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include <tl_indexed.hxx>
+#include <tl_matching_strategy.hxx>
+#include <tl_typelist.hxx>
+
+namespace pi::tl::internal
+{
+    /*! Up to Size positions, the first count of which are used. */
+    template <size_t Size>
+    struct position_list
+    {
+        std::array<size_t, Size> positions{};
+        size_t count{ 0 };
+
+        void constexpr push(size_t const position) noexcept
+        {
+            positions[count++] = position;
+        }
+
+        /*! The positions that are used, in an array of their size (Count is count). */
+        template <size_t Count>
+        [[nodiscard]] auto constexpr used() const noexcept
+        {
+            auto result = std::array<size_t, Count>{};
+            std::copy_n(positions.begin(), Count, result.begin());
+            return result;
+        }
+    };
+
+    /*! The elements of List at the positions in the std::array Positions. */
+    template <typename List, auto const &Positions, typename Indices = std::make_index_sequence<Positions.size()>>
+    struct select;
+
+    template <typename ...TypeList, auto const &Positions, size_t ...Indices>
+    struct select<typelist<TypeList...>, Positions, std::index_sequence<Indices...>>
+    {
+        using type = typelist<type_at_t<Positions[Indices], TypeList...>...>;
+    };
+
+    template <typename List, auto const &Positions>
+    using select_t = typename select<List, Positions>::type;
+
+    template <typename ...LeftList, typename ...RightList>
+    auto operator +(typelist<LeftList...>, typelist<RightList...>) -> typelist<LeftList..., RightList...>;
+
+    /*! The types of all the Lists (typelists), in order, joined by a single fold expression: no recursion. */
+    template <typename ...Lists>
+    struct concat
+    {
+        using type = decltype((typelist<>{} + ... + std::declval<Lists>()));
+    };
+
+    /*! The positions of the elements of TypeList for which Predicate, given the element adjusted by Strategy, is Expected. */
+    template <template <typename> typename Predicate, matching Strategy, bool Expected, typename ...TypeList>
+    auto consteval find_satisfying()
+    {
+        auto constexpr flags = std::array<bool, sizeof...(TypeList)>{ static_cast<bool>(Predicate<apply_strategy_t<Strategy, TypeList>>::value)... };
+        auto found = position_list<sizeof...(TypeList)>{};
+        for (auto index = size_t{ 0 }; index < flags.size(); ++index)
+            if (flags[index] == Expected)
+                found.push(index);
+
+        return found;
+    }
+
+    template <template <typename> typename Predicate, matching Strategy, bool Expected, typename ...TypeList>
+    auto consteval make_satisfying_positions()
+    {
+        auto constexpr found = find_satisfying<Predicate, Strategy, Expected, TypeList...>();
+        return found.template used<found.count>();
+    }
+
+    template <template <typename> typename Predicate, matching Strategy, bool Expected, typename ...TypeList>
+    auto inline constexpr satisfying_positions = make_satisfying_positions<Predicate, Strategy, Expected, TypeList...>();
+
+    template <template <typename> typename Predicate, matching Strategy, bool Expected, typename List>
+    struct filter;
+
+    template <template <typename> typename Predicate, matching Strategy, bool Expected, typename ...TypeList>
+    struct filter<Predicate, Strategy, Expected, typelist<TypeList...>>
+    {
+        using type = select_t<typelist<TypeList...>, satisfying_positions<Predicate, Strategy, Expected, TypeList...>>;
+    };
+
+    template <template <typename> typename Transform, matching Strategy, typename List>
+    struct transform;
+
+    template <template <typename> typename Transform, matching Strategy, typename ...TypeList>
+    struct transform<Transform, Strategy, typelist<TypeList...>>
+    {
+        using type = typelist<Transform<apply_strategy_t<Strategy, TypeList>>...>;
+    };
+
+    template <typename List, size_t Begin, size_t End>
+    struct slice;
+
+    template <typename ...TypeList, size_t Begin, size_t End>
+    struct slice<typelist<TypeList...>, Begin, End>
+    {
+        static_assert(Begin <= End && End <= sizeof...(TypeList), "The slice must be within the list.");
+
+        template <size_t ...Indices>
+        static auto from(std::index_sequence<Indices...>) -> typelist<type_at_t<Begin + Indices, TypeList...>...>;
+
+        using type = decltype(from(std::make_index_sequence<End - Begin>{}));
+    };
+
+    template <typename List>
+    struct reverse;
+
+    template <typename ...TypeList>
+    struct reverse<typelist<TypeList...>>
+    {
+        template <size_t ...Indices>
+        static auto from(std::index_sequence<Indices...>) -> typelist<type_at_t<sizeof...(TypeList) - 1U - Indices, TypeList...>...>;
+
+        using type = decltype(from(std::index_sequence_for<TypeList...>{}));
+    };
+}
+
+#endif
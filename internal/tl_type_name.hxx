@@ -0,0 +1,61 @@
+#ifndef PITYPELISTS_TL_TYPE_NAME_HXX
+#define PITYPELISTS_TL_TYPE_NAME_HXX
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace pi::tl::internal
+{
+    template <typename Type>
+    [[nodiscard]] auto consteval decorated_name()
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return std::string_view{ __FUNCSIG__ };
+#else
+        return std::string_view{ __PRETTY_FUNCTION__ };
+#endif
+    }
+
+    // The decoration around the type in decorated_name, measured on a type whose spelling is known.
+    auto inline constexpr probe_name = decorated_name<void>();
+    auto inline constexpr name_prefix = probe_name.find("void");
+    auto inline constexpr name_suffix = probe_name.size() - name_prefix - std::string_view{ "void" }.size();
+
+    /*!
+     * @brief The name of Type, as spelled by the compiler.
+     * @note The spelling differs between compilers (e.g. of anonymous namespaces), but not between builds by the same one.
+     */
+    template <typename Type>
+    [[nodiscard]] auto consteval type_name()
+    {
+        auto constexpr name = decorated_name<Type>();
+        return name.substr(name_prefix, name.size() - name_prefix - name_suffix);
+    }
+
+    /*! The 64-bit FNV-1a hash of text, continuing from seed. */
+    [[nodiscard]] auto constexpr fnv1a(std::string_view const text, uint64_t seed = 0xcbf29ce484222325ULL) noexcept
+    {
+        for (auto const character : text)
+        {
+            seed ^= static_cast<uint64_t>(static_cast<unsigned char>(character));
+            seed *= 0x100000001b3ULL;
+        }
+
+        return seed;
+    }
+
+    /*! Mixes value into seed, byte by byte, the way fnv1a mixes characters. */
+    [[nodiscard]] auto constexpr fnv1a(uint64_t value, uint64_t seed) noexcept
+    {
+        for (auto byte = 0; byte < 8; ++byte, value >>= 8U)
+        {
+            seed ^= value & 0xffU;
+            seed *= 0x100000001b3ULL;
+        }
+
+        return seed;
+    }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef PITYPELISTS_TL_TYPELIST_HXX
+#define PITYPELISTS_TL_TYPELIST_HXX
+
+#include <cstddef>
+
+#include <tl_indexed.hxx>
+#include <tl_match_table.hxx>
+#include <tl_matching_strategy.hxx>
+
+namespace pi::tl
+{
+    /*!
+     * @brief A list of types, to be passed around as a value and queried (count, find, find_nth) repeatedly.
+     * The position table of each searched type is built once, on its first query, and shared by all the following ones.
+     * @tparam TypeList The types in the list
+     */
+    template <typename ...TypeList>
+    struct typelist
+    {
+        size_t static constexpr size = sizeof...(TypeList);
+
+        /*! The 0-based indices of SearchedType in the list (a std::array), respecting the matching Strategy. */
+        template <matching Strategy, typename SearchedType>
+        static constexpr auto const &positions = internal::position_table<apply_strategy_t<Strategy, SearchedType>, apply_strategy_t<Strategy, TypeList>...>;
+
+        /*! The type at the 0-based Index in the list. */
+        template <size_t Index>
+        using at_t = internal::type_at_t<Index, TypeList...>;
+    };
+}
+
+#endif
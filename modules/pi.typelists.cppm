@@ -0,0 +1,116 @@
+module;
+
+// The headers are parsed once, when the module is built; the translation units that import it read the compiled
+// interface instead. The macros (AUTO_TAG, TAG) are not exported by a module: use td::tag<"name">, or include
+// typedecl.hxx where they are needed.
+#include <argument_spec.hxx>
+#include <codec.hxx>
+#include <dynamic_struct.hxx>
+#include <simd.hxx>
+#include <struct.hxx>
+#include <struct_vector.hxx>
+#include <typedecl.hxx>
+#include <typelists.hxx>
+
+export module pi.typelists;
+
+export namespace pi::tl
+{
+    // typelists.hxx
+    using pi::tl::matching;
+    using pi::tl::apply_strategy_t;
+    using pi::tl::npos;
+    using pi::tl::typelist;
+
+    using pi::tl::count;
+    using pi::tl::find;
+    using pi::tl::find_nth;
+    using pi::tl::count_each;
+    using pi::tl::find_each;
+    using pi::tl::contains_only;
+    using pi::tl::get;
+    using pi::tl::get_variant;
+    using pi::tl::visit_at;
+    using pi::tl::get_or_initialize;
+    using pi::tl::get_nth_or_initialize;
+    using pi::tl::get_or_invoke;
+    using pi::tl::get_nth_or_invoke;
+
+    using pi::tl::sort_t;
+    using pi::tl::unique_t;
+    using pi::tl::canonical_t;
+    using pi::tl::set_union_t;
+    using pi::tl::set_intersection_t;
+    using pi::tl::concat_t;
+    using pi::tl::filter_t;
+    using pi::tl::transform_t;
+    using pi::tl::partition_t;
+    using pi::tl::slice_t;
+    using pi::tl::reverse_t;
+    using pi::tl::apply;
+    using pi::tl::apply_t;
+
+    // struct.hxx
+    using pi::tl::layout;
+    using pi::tl::basic_struct_t;
+    using pi::tl::struct_t;
+    using pi::tl::packed_struct_t;
+    using pi::tl::basic_struct_with_consts_t;
+    using pi::tl::struct_with_consts_t;
+    using pi::tl::packed_struct_with_consts_t;
+    using pi::tl::layout_report;
+
+    // struct_vector.hxx, dynamic_struct.hxx
+    using pi::tl::struct_vector;
+    using pi::tl::dynamic_struct;
+
+    // argument_spec.hxx
+    using pi::tl::field;
+    using pi::tl::lazy;
+    using pi::tl::required;
+    using pi::tl::argument_spec;
+
+    // codec.hxx
+    using pi::tl::encoding;
+    using pi::tl::schema_hash_v;
+    using pi::tl::is_encodable_v;
+    using pi::tl::encoded_size;
+    using pi::tl::encode;
+    using pi::tl::decode;
+}
+
+export namespace pi::td
+{
+    // typedecl.hxx
+    using pi::td::typedecl;
+    using pi::td::arithmetic;
+    using pi::td::comparison;
+    using pi::td::fixed_string;
+    using pi::td::tag;
+    using pi::td::type_id;
+    using pi::td::type_id_v;
+    using pi::td::is_trivially_relocatable;
+    using pi::td::is_trivially_relocatable_v;
+    using pi::td::relocate;
+    using pi::td::transparent_hash;
+}
+
+export namespace pi::td::simd
+{
+    // simd.hxx
+    using pi::td::simd::is_fundamental_typedecl;
+    using pi::td::simd::column;
+    using pi::td::simd::output_column;
+    using pi::td::simd::same_strong_type;
+    using pi::td::simd::add;
+    using pi::td::simd::subtract;
+    using pi::td::simd::multiply;
+    using pi::td::simd::divide;
+    using pi::td::simd::fma;
+    using pi::td::simd::min;
+    using pi::td::simd::max;
+    using pi::td::simd::clamp;
+    using pi::td::simd::sum;
+    using pi::td::simd::minimum;
+    using pi::td::simd::maximum;
+}
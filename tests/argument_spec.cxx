@@ -0,0 +1,153 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using namespace Catch::Matchers;
+
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include <argument_spec.hxx>
+using namespace pi::tl;
+
+#include <toolbox.hxx>
+
+namespace
+{
+    using name_t = pi::td::typedecl<std::string, TAG(SpecName)>;
+    using x_t = pi::td::typedecl<double, TAG(SpecX)>;
+    using y_t = pi::td::typedecl<double, TAG(SpecY)>;
+    using health_t = pi::td::typedecl<int, TAG(SpecHealth)>;
+    using callback_t = pi::td::typedecl<std::function<int()>, TAG(SpecCallback)>;
+    using action_t = pi::td::typedecl<std::function<void()>, TAG(SpecAction)>;
+
+    /*! Counts how it was constructed. */
+    struct tracked_t
+    {
+        int value{};
+        int copies{};
+        int moves{};
+
+        tracked_t() = default;
+        explicit tracked_t(int const initial) : value{ initial } {}
+        tracked_t(tracked_t const &other) : value{ other.value }, copies{ other.copies + 1 }, moves{ other.moves } {}
+        tracked_t(tracked_t &&other) noexcept : value{ other.value }, copies{ other.copies }, moves{ other.moves + 1 } {}
+        tracked_t &operator =(tracked_t const &) = default;
+        tracked_t &operator =(tracked_t &&) noexcept = default;
+        ~tracked_t() = default;
+    };
+
+    int default_names = 0; // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+    using player_spec = argument_spec<
+        field<name_t, lazy{ [] { ++default_names; return name_t{ "Player 1" }; } }>,
+        field<x_t, 100.0>,
+        field<y_t, 10.0>,
+        field<health_t, 100, 1U>>;
+
+    template <typename ...Arguments>
+    auto initialize(Arguments &&...arguments)
+    {
+        return player_spec::parse(std::forward<Arguments>(arguments)...);
+    }
+}
+
+SCENARIO("Argument spec") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a spec with defaults, one of which is built by a function")
+    {
+        THEN("parse returns a struct of the fields, in the order of the spec")
+        {
+            STATIC_REQUIRE(std::is_same_v<player_spec::struct_type, struct_t<name_t, x_t, y_t, health_t>>);
+            STATIC_REQUIRE(std::is_same_v<decltype(initialize(health_t{ 1 })), player_spec::struct_type>);
+        }
+
+        THEN("the absent arguments are initialized from their defaults, which are only built then")
+        {
+            default_names = 0;
+            auto player = initialize(health_t{ 5 });
+            REQUIRE(player.get<name_t>() == "Player 1");
+            REQUIRE_THAT(player.get<x_t>(), WithinAbs(100.0, pi::epsilon<double>));
+            REQUIRE_THAT(player.get<y_t>(), WithinAbs(10.0, pi::epsilon<double>));
+            REQUIRE(player.get<health_t>() == 5);
+            REQUIRE(default_names == 1);
+
+            player = initialize(health_t{ 5 }, name_t{ "Batman" });
+            REQUIRE(player.get<name_t>() == "Batman");
+            REQUIRE(default_names == 1);
+        }
+
+        THEN("the arguments are given in any order, and matched with relaxed matching")
+        {
+            auto const y = y_t{ 2.0 };
+            auto player = initialize(y, name_t{ "Superman" }, health_t{ 7 }, x_t{ 1.0 });
+            REQUIRE(player.get<name_t>() == "Superman");
+            REQUIRE_THAT(player.get<x_t>(), WithinAbs(1.0, pi::epsilon<double>));
+            REQUIRE_THAT(player.get<y_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE(player.get<health_t>() == 7);
+        }
+    }
+
+    GIVEN("a spec of a field that may be given more than once")
+    {
+        using spec = argument_spec<field<tracked_t, 0, 0U, 2U>, field<health_t>>;
+
+        THEN("the field is constructed from the first argument of its type, which is moved if it is an rvalue")
+        {
+            auto parsed = spec::parse(tracked_t{ 1 }, tracked_t{ 2 });
+            REQUIRE(parsed.get<tracked_t>().value == 1);
+            REQUIRE(parsed.get<tracked_t>().copies == 0);
+            REQUIRE(parsed.get<tracked_t>().moves == 1);
+            REQUIRE(parsed.get<health_t>() == 0);
+        }
+
+        THEN("an lvalue argument is copied once, and the default is constructed in place")
+        {
+            auto const first = tracked_t{ 3 };
+            auto copied = spec::parse(first);
+            REQUIRE(copied.get<tracked_t>().value == 3);
+            REQUIRE(copied.get<tracked_t>().copies == 1);
+            REQUIRE(copied.get<tracked_t>().moves == 0);
+
+            auto defaulted = spec::parse(health_t{ 4 });
+            REQUIRE(defaulted.get<tracked_t>().value == 0);
+            REQUIRE(defaulted.get<tracked_t>().copies == 0);
+            REQUIRE(defaulted.get<tracked_t>().moves == 0);
+        }
+    }
+
+    GIVEN("a spec of distinct strong types over the same underlying type")
+    {
+        using spec = argument_spec<field<x_t, 1.0>, field<y_t, 2.0>>;
+
+        THEN("each argument is attributed to the field of its own type")
+        {
+            auto const parsed = spec::parse(y_t{ 3.0 });
+            REQUIRE_THAT(parsed.get<x_t>(), WithinAbs(1.0, pi::epsilon<double>));
+            REQUIRE_THAT(parsed.get<y_t>(), WithinAbs(3.0, pi::epsilon<double>));
+        }
+    }
+
+    GIVEN("a spec of fundamental strong types")
+    {
+        using spec = argument_spec<field<x_t, 1.0>, field<health_t, 3>>;
+
+        THEN("the arguments can be parsed at compile time")
+        {
+            STATIC_REQUIRE(static_cast<int>(spec::parse(health_t{ 8 }).get<health_t>()) == 8);
+            STATIC_REQUIRE(static_cast<double>(spec::parse(health_t{ 8 }).get<x_t>()) == 1.0);
+        }
+    }
+
+    GIVEN("a spec of fields that are function objects, with function objects as defaults")
+    {
+        using spec = argument_spec<field<callback_t, [] { return 42; }>, field<action_t, [] {}>>;
+
+        THEN("the defaults are the values of the fields, they are not called")
+        {
+            auto parsed = spec::parse();
+            REQUIRE(parsed.get<callback_t>()() == 42);
+            REQUIRE(static_cast<bool>(parsed.get<action_t>()));
+        }
+    }
+}
@@ -0,0 +1,208 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using namespace Catch::Matchers;
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <codec.hxx>
+using namespace pi::tl;
+
+#include <toolbox.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, TAG(CodecX)>;
+    using y_t = pi::td::typedecl<double, TAG(CodecY)>;
+    using hp_t = pi::td::typedecl<int, TAG(CodecHP)>;
+    using mana_t = pi::td::typedecl<int, TAG(CodecMana)>;
+    using name_t = pi::td::typedecl<std::string, TAG(CodecName)>;
+    using scores_t = pi::td::typedecl<std::vector<int>, TAG(CodecScores)>;
+    using target_t = pi::td::typedecl<std::unique_ptr<int>, TAG(CodecTarget)>;
+    using owner_t = pi::td::typedecl<std::unique_ptr<int>, TAG(CodecOwner)>;
+
+    using npc_v1_t = struct_t<x_t, y_t, hp_t>;
+    using npc_v2_t = struct_t<mana_t, hp_t, x_t>;
+    using player_v1_t = struct_t<name_t, hp_t, scores_t, target_t>;
+    using player_v2_t = struct_t<hp_t, scores_t>;
+}
+
+/*! A target is encoded as the int it points to, or as nothing when it is null. */
+template <>
+struct pi::tl::field_codec<target_t>
+{
+    [[nodiscard]] size_t static size(target_t const &target) noexcept
+    {
+        return target ? sizeof(int) : 0U;
+    }
+
+    void static encode(target_t const &target, std::span<std::byte> const bytes) noexcept
+    {
+        if (target)
+            std::memcpy(bytes.data(), target.get(), sizeof(int));
+    }
+
+    void static decode(std::span<std::byte const> const bytes, target_t &target)
+    {
+        if (bytes.empty())
+            return target.reset();
+
+        if (bytes.size() != sizeof(int))
+            throw std::invalid_argument("An encoded target is an int.");
+
+        auto value = 0;
+        std::memcpy(&value, bytes.data(), sizeof(int));
+        target.reset(new int{ value });
+    }
+};
+
+static_assert(is_raw_encodable_v<npc_v1_t> && is_raw_encodable_v<packed_struct_t<x_t, hp_t>> && is_raw_encodable_v<x_t>);
+static_assert(is_encodable_v<npc_v1_t> && is_encodable_v<player_v1_t> && !is_raw_encodable_v<player_v1_t> && !is_raw_encodable_v<name_t>);
+static_assert(!is_encodable_v<struct_t<x_t, owner_t>>);
+static_assert(schema_hash_v<npc_v1_t> != schema_hash_v<npc_v2_t> && schema_hash_v<npc_v1_t> != schema_hash_v<packed_struct_t<x_t, y_t, hp_t>>);
+static_assert(schema_hash_v<x_t> != schema_hash_v<y_t>);
+
+SCENARIO("Codec")
+{
+    GIVEN("A few records and a buffer")
+    {
+        auto const npcs = std::vector<npc_v1_t>{ npc_v1_t{ x_t{ 1.0 }, y_t{ 2.0 }, hp_t{ 100 } }, npc_v1_t{ hp_t{ 50 }, x_t{ 3.0 } } };
+        auto buffer = std::array<std::byte, 256U>{};
+
+        THEN("The raw encoding writes a header, then the records as they are in memory")
+        {
+            auto const size = encode(npcs, buffer);
+            REQUIRE(size == encoded_size<npc_v1_t>(2U));
+            REQUIRE(size == 24U + 2U * sizeof(npc_v1_t));
+
+            auto decoded = std::vector<npc_v1_t>(3U);
+            REQUIRE(decode(std::span{ buffer }.first(size), decoded) == 2U);
+            REQUIRE_THAT(decoded[0].get<y_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE(decoded[1].get<hp_t>() == 50);
+            REQUIRE_THAT(decoded[1].get<x_t>(), WithinAbs(3.0, pi::epsilon<double>));
+        }
+
+        THEN("Raw records cannot be decoded with another schema, tagged ones can")
+        {
+            auto const raw_size = encode(npcs, buffer);
+            auto v2 = std::vector<npc_v2_t>(2U);
+            REQUIRE_THROWS_AS(decode(std::span{ buffer }.first(raw_size), v2), std::invalid_argument);
+
+            auto const tagged_size = encode(npcs, buffer, encoding::tagged);
+            REQUIRE(tagged_size == encoded_size<npc_v1_t>(2U, encoding::tagged));
+            REQUIRE(decode(std::span{ buffer }.first(tagged_size), v2) == 2U);
+
+            // y_t was removed and is skipped; mana_t was added and is value-initialized
+            REQUIRE(v2[0].get<hp_t>() == 100);
+            REQUIRE_THAT(v2[0].get<x_t>(), WithinAbs(1.0, pi::epsilon<double>));
+            REQUIRE(v2[0].get<mana_t>() == 0);
+            REQUIRE(v2[1].get<hp_t>() == 50);
+        }
+
+        THEN("Encoding into a buffer that is too small writes nothing, decoding a truncated buffer throws")
+        {
+            auto small = std::array<std::byte, 20U>{};
+            REQUIRE_THROWS_AS(encode(npcs, small), std::length_error);
+            REQUIRE(small[0] == std::byte{ 0 });
+
+            auto const size = encode(npcs, buffer, encoding::tagged);
+            auto decoded = std::vector<npc_v1_t>(2U);
+            REQUIRE_THROWS_AS(decode(std::span{ buffer }.first(size - 1U), decoded), std::length_error);
+            REQUIRE_THROWS_AS(decode(std::span{ buffer }.first(size), std::span{ decoded }.first(1U)), std::length_error);
+        }
+
+        THEN("The number of records is written on 64 bits, so it is never truncated")
+        {
+            encode(npcs, buffer);
+            auto count = uint64_t{};
+            std::memcpy(&count, buffer.data() + 16U, sizeof(count));
+            REQUIRE(count == 2U);
+
+            // 2^32 + 2 records: read as 32 bits, the count would be 2
+            count = (uint64_t{ 1 } << 32U) + 2U;
+            std::memcpy(buffer.data() + 16U, &count, sizeof(count));
+            auto decoded = std::vector<npc_v1_t>(2U);
+            REQUIRE_THROWS_AS(decode(std::span{ buffer }, decoded), std::length_error);
+
+            // The 16 bytes header of the previous versions is rejected
+            buffer[12] = std::byte{ 2 };
+            REQUIRE_THROWS_AS(decode(std::span{ buffer }, decoded), std::invalid_argument);
+        }
+    }
+
+    GIVEN("Records with fields that are not trivially copyable")
+    {
+        auto players = std::vector<player_v1_t>(2U);
+        players[0] = player_v1_t{ name_t{ "Link" }, hp_t{ 3 }, scores_t{ 10, 20, 30 }, target_t{ new int{ 7 } } };
+        players[1] = player_v1_t{ hp_t{ 5 } };
+        auto buffer = std::array<std::byte, 256U>{};
+
+        THEN("The tagged encoding writes each field with its field_codec, and they round trip")
+        {
+            auto const size = encode(players, buffer, encoding::tagged);
+            REQUIRE(size == encoded_size(players, encoding::tagged));
+
+            auto decoded = std::vector<player_v1_t>(2U);
+            REQUIRE(decode(std::span{ buffer }.first(size), decoded) == 2U);
+            REQUIRE(decoded[0].get<name_t>() == "Link");
+            REQUIRE(decoded[0].get<hp_t>() == 3);
+            REQUIRE(decoded[0].get<scores_t>() == std::vector<int>{ 10, 20, 30 });
+            REQUIRE(*decoded[0].get<target_t>() == 7);
+            REQUIRE(decoded[1].get<name_t>().empty());
+            REQUIRE(decoded[1].get<scores_t>().empty());
+            REQUIRE(decoded[1].get<target_t>() == nullptr);
+        }
+
+        THEN("Fields can be added to or removed from them between versions")
+        {
+            auto const size = encode(players, buffer, encoding::tagged);
+            auto v2 = std::vector<player_v2_t>(2U);
+            REQUIRE(decode(std::span{ buffer }.first(size), v2) == 2U);
+            REQUIRE(v2[0].get<hp_t>() == 3);
+            REQUIRE(v2[0].get<scores_t>() == std::vector<int>{ 10, 20, 30 });
+            REQUIRE(v2[1].get<hp_t>() == 5);
+        }
+
+        THEN("They cannot be encoded raw, and an encoded field of the wrong size is rejected")
+        {
+            REQUIRE_THROWS_AS(encode(players, buffer), std::invalid_argument);
+            REQUIRE(buffer[0] == std::byte{ 0 });
+
+            auto const size = encode(struct_t<scores_t>{ scores_t{ 1, 2 } }, buffer, encoding::tagged);
+            buffer[size - 2U * sizeof(int) - sizeof(uint32_t)] = std::byte{ 7 };
+            REQUIRE_THROWS_AS(decode<struct_t<scores_t>>(std::span{ buffer }.first(size)), std::invalid_argument);
+        }
+    }
+
+    GIVEN("A single packed struct and a single typedecl")
+    {
+        auto buffer = std::array<std::byte, 128U>{};
+
+        THEN("They round trip")
+        {
+            using packed_t = packed_struct_t<hp_t, x_t, hp_t>;
+            auto const size = encode(packed_t{ hp_t{ 1 }, x_t{ 2.0 }, hp_t{ 3 } }, buffer, encoding::tagged);
+            auto const packed = decode<packed_t>(std::span{ buffer }.first(size));
+
+            auto hps = std::vector<int>{};
+            packed.for_each_field([&hps](auto, auto const &field)
+            {
+                if constexpr (std::is_same_v<std::decay_t<decltype(field)>, hp_t>)
+                    hps.push_back(field);
+            });
+            REQUIRE(hps == std::vector<int>{ 1, 3 });
+
+            encode(y_t{ 4.0 }, buffer);
+            REQUIRE_THAT(decode<y_t>(buffer), WithinAbs(4.0, pi::epsilon<double>));
+            REQUIRE_THROWS_AS(decode<x_t>(buffer), std::invalid_argument);
+        }
+    }
+}
@@ -0,0 +1,186 @@
+#!/usr/bin/env python3
+"""
+Checks that the abstractions of PiTypeLists compile to the same instructions as the raw code they replace.
+
+The probes file defines pairs of extern "C" functions, raw_<name> and pi_<name>. It is compiled to assembly with the given
+optimization level. The body of each function is what follows its label in the code section, up to its end (.size,
+.cfi_endproc, or the next function); it is normalized: directives and comments are removed, each reference to a label of
+a data section (a constant pool such as .LC0 or .LCPI0_0, a jump table) is replaced with the data it labels, and the other
+local labels are renumbered in order of appearance. Each pi_<name> must be identical to its raw_<name>. Divergences are
+printed as unified diffs and make the script exit with 1.
+
+Only x86 targets are supported: the comments are stripped with the x86 syntax, where '#' starts a comment.
+"""
+
+import argparse
+import difflib
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+RAW_PREFIX = "raw_"
+PI_PREFIX = "pi_"
+
+# A label at the start of a line; local labels (.L12, L12, LBB0_3, .LCPI0_0, lCPI0_0, ...) are renumbered or resolved to
+# their data, the others start a function.
+LABEL = re.compile(r"^([A-Za-z_.$][\w.$]*):")
+LOCAL_SYMBOL = re.compile(r"\.?[Ll][A-Za-z_]*\d+(?:_\d+)?")
+SECTION = re.compile(r"^\.(section|text|data|bss|rodata|previous|pushsection|popsection)\b\s*(\S*)")
+FUNCTION_END = re.compile(r"^\.(size|cfi_endproc)\b")
+DATA = re.compile(r"^\.(byte|short|value|word|hword|[248]byte|long|int|quad|octa|zero|skip|space|ascii|asciz|string|"
+                  r"float|single|double)\b")
+
+
+def parse_arguments():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--compiler", required=True, help="the C++ compiler")
+    parser.add_argument("--compiler-id", default="GNU", help="CMake's compiler ID (GNU, Clang, AppleClang)")
+    parser.add_argument("--include", action="append", default=[], help="include directory (repeatable)")
+    parser.add_argument("--flag", action="append", default=[], help="extra compiler flag, e.g. -O2 (repeatable)")
+    parser.add_argument("--probes", required=True, help="the source file of the probe functions")
+    return parser.parse_args()
+
+
+def compile_to_assembly(arguments, target):
+    command = ([arguments.compiler, "-std=c++20", "-S", "-fno-asynchronous-unwind-tables", arguments.probes, "-o", target]
+               + ["-I" + include for include in arguments.include] + arguments.flag)
+    if arguments.compiler_id == "GNU":
+        # Identical code folding would turn pi_<name> into an alias of (or a jump to) raw_<name>.
+        command.append("-fno-ipa-icf")
+    subprocess.run(command, check=True)
+    with open(target, encoding="utf-8") as assembly:
+        return assembly.read().splitlines()
+
+
+def strip_comment(line):
+    """The line without its comment, in x86 assembly (AT&T or Intel syntax): on AArch64 and ARM, '#' starts an immediate."""
+    return line.split("#")[0].split(";")[0].split("//")[0].strip()
+
+
+def is_code_section(directive, name):
+    """Whether a section directive switches to code: .text or .text.<function> (ELF), __TEXT,__text (Mach-O)."""
+    elf_name = name.split(",")[0]
+    return directive == "text" or elf_name == ".text" or elf_name.startswith(".text.") or name.startswith("__TEXT,__text")
+
+
+def split_functions(lines):
+    """
+    The lines of each probe, by name (without the leading underscore of Mach-O symbols), and the data directives that
+    follow each label of a data section, by label. A probe ends at its .size or .cfi_endproc directive, or at the next
+    function; the lines in other sections, e.g. its jump tables and the constant pools at the end of the file, are not
+    part of it.
+    """
+    functions = {}
+    data = {}
+    current = None
+    in_code, previous_in_code, pushed = True, True, []
+    data_label = None
+    for line in lines:
+        code = strip_comment(line)
+        section = SECTION.match(code)
+        if section:
+            directive, name = section.groups()
+            if directive == "previous":
+                in_code, previous_in_code = previous_in_code, in_code
+            elif directive == "popsection":
+                in_code = pushed.pop() if pushed else True
+            else:
+                if directive == "pushsection":
+                    pushed.append(in_code)
+                previous_in_code, in_code = in_code, is_code_section(directive, name)
+            data_label = None
+            continue
+
+        label = LABEL.match(code)
+        if not in_code:
+            if label:
+                data_label = label.group(1)
+                data[data_label] = []
+            elif data_label is not None and DATA.match(code):
+                data[data_label].append(" ".join(code.split()))
+            continue
+
+        if label and not LOCAL_SYMBOL.fullmatch(label.group(1)):
+            name = label.group(1).lstrip("_")
+            current = functions.setdefault(name, []) if name.startswith((RAW_PREFIX, PI_PREFIX)) else None
+            continue
+        if FUNCTION_END.match(code):
+            current = None
+            continue
+        if current is not None:
+            current.append(line)
+    return functions, data
+
+
+def normalize(lines, data):
+    """
+    Keeps the instructions and the local labels they refer to. A reference to a data label is replaced with its data, so that two constant
+    pools of different values differ; the other local symbols, and the data labels referenced from their own data (the
+    entries of a jump table are relative to it), are renumbered in order of appearance.
+    """
+    symbols = {}
+    resolving = set()
+
+    def rename(match):
+        symbol = match.group(0)
+        if symbol in data and symbol not in resolving:
+            resolving.add(symbol)
+            resolved = "{%s}" % "; ".join(LOCAL_SYMBOL.sub(rename, directive) for directive in data[symbol])
+            resolving.remove(symbol)
+            return resolved
+        return symbols.setdefault(symbol, "L%d" % len(symbols))
+
+    codes = [code for code in map(strip_comment, lines) if code and (not code.startswith(".") or LABEL.match(code))]
+    # The labels that no instruction jumps to (function begin, debug information) are not part of the code.
+    pending = [symbol for code in codes if not LABEL.match(code) for symbol in LOCAL_SYMBOL.findall(code)]
+    referenced = set()
+    while pending:
+        symbol = pending.pop()
+        if symbol not in referenced:
+            referenced.add(symbol)
+            pending.extend(found for directive in data.get(symbol, []) for found in LOCAL_SYMBOL.findall(directive))
+
+    normalized = []
+    for code in codes:
+        label = LABEL.match(code)
+        if label and label.group(1) not in referenced:
+            continue
+        normalized.append(" ".join(LOCAL_SYMBOL.sub(rename, code).split()))
+    return normalized
+
+
+def main():
+    arguments = parse_arguments()
+    with tempfile.TemporaryDirectory() as directory:
+        functions, data = split_functions(compile_to_assembly(arguments, os.path.join(directory, "probes.s")))
+
+    flags = " ".join(arguments.flag)
+    failures = 0
+    pairs = sorted(name[len(RAW_PREFIX):] for name in functions if name.startswith(RAW_PREFIX))
+    for name in pairs:
+        raw = normalize(functions[RAW_PREFIX + name], data)
+        abstraction = functions.get(PI_PREFIX + name)
+        if abstraction is None:
+            print("%s%s has no %s%s counterpart" % (RAW_PREFIX, name, PI_PREFIX, name))
+            failures += 1
+            continue
+
+        abstraction = normalize(abstraction, data)
+        if raw == abstraction:
+            print("same code   %-24s (%d instructions, %s)" % (name, len(raw), flags))
+        else:
+            print("DIFFERENT   %-24s (%s)" % (name, flags))
+            sys.stdout.writelines(line + "\n" for line in difflib.unified_diff(
+                raw, abstraction, fromfile=RAW_PREFIX + name, tofile=PI_PREFIX + name, lineterm=""))
+            failures += 1
+
+    if not pairs:
+        print("No %s<name> probe found in %s" % (RAW_PREFIX, arguments.probes))
+        return 1
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
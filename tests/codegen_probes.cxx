@@ -0,0 +1,132 @@
+// Pairs of functions that must compile to the same instructions: raw_<name>, written with the underlying types, and
+// pi_<name>, written with the abstraction. They are compiled on their own (not in the tests executable) and compared by
+// tests/codegen_equivalence.py; see the codegen_equivalence tests in CMakeLists.txt.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include <struct.hxx>
+#include <typedecl.hxx>
+#include <typelists.hxx>
+
+namespace
+{
+    using meters_t = pi::td::typedecl<double, pi::td::tag<"codegen.meters">, pi::td::arithmetic, pi::td::comparison>;
+
+    using x_t = pi::td::typedecl<double, pi::td::tag<"codegen.x">>;
+    using y_t = pi::td::typedecl<double, pi::td::tag<"codegen.y">>;
+    using hp_t = pi::td::typedecl<int, pi::td::tag<"codegen.hp">>;
+    using row_id_t = pi::td::typedecl<int64_t, pi::td::tag<"codegen.row_id">>;
+
+    // the layout of std::tuple<double, double, int>, which is that of struct_t: in reverse, except with libc++
+    struct raw_record_t
+    {
+#if defined(_LIBCPP_VERSION)
+        double x;
+        double y;
+        int hp;
+#else
+        int hp;
+        double y;
+        double x;
+#endif
+    };
+
+    using record_t = pi::tl::struct_t<x_t, y_t, hp_t>;
+}
+
+// NOLINTBEGIN(readability-identifier-naming, misc-use-anonymous-namespace)
+extern "C"
+{
+    // typedecl arithmetic, comparison and conversion
+    double raw_add(double const left, double const right)
+    {
+        return left + right;
+    }
+
+    double pi_add(double const left, double const right)
+    {
+        return static_cast<double>(meters_t{ left } + meters_t{ right });
+    }
+
+    bool raw_less(double const left, double const right)
+    {
+        return left < right;
+    }
+
+    bool pi_less(double const left, double const right)
+    {
+        return meters_t{ left } < meters_t{ right };
+    }
+
+    void raw_integrate(double *positions, double const *velocities, double const dt, std::size_t const size)
+    {
+        for (auto index = std::size_t{ 0 }; index < size; ++index)
+            positions[index] += velocities[index] * dt;
+    }
+
+    void pi_integrate(meters_t *positions, meters_t const *velocities, double const dt, std::size_t const size)
+    {
+        for (auto index = std::size_t{ 0 }; index < size; ++index)
+            positions[index] += velocities[index] * dt;
+    }
+
+    // get<Index> and get_or_initialize
+    int raw_get(int const first, int const second, int const third, int const fourth)
+    {
+        static_cast<void>(first);
+        static_cast<void>(second);
+        static_cast<void>(fourth);
+        return third;
+    }
+
+    int pi_get(int const first, int const second, int const third, int const fourth)
+    {
+        return pi::tl::get<2U>(first, second, third, fourth);
+    }
+
+    double raw_get_or_initialize(int const first, double const second)
+    {
+        static_cast<void>(first);
+        return second;
+    }
+
+    double pi_get_or_initialize(int const first, double const second)
+    {
+        return pi::tl::get_or_initialize(-1.0, first, second);
+    }
+
+    // struct_t::get<Type>() and struct_t::set, on a struct with the layout of the hand-written one
+    double raw_struct_get(raw_record_t *record)
+    {
+        return record->y + record->hp;
+    }
+
+    double pi_struct_get(record_t *record)
+    {
+        return record->get<y_t>() + record->get<hp_t>();
+    }
+
+    void raw_struct_set(raw_record_t *record, double const x)
+    {
+        record->x = x;
+    }
+
+    void pi_struct_set(record_t *record, double const x)
+    {
+        record->set(x_t{ x });
+    }
+
+    // std::hash of a typedecl is that of its underlying type
+    std::size_t raw_hash(int64_t const id)
+    {
+        return std::hash<int64_t>{}(id);
+    }
+
+    std::size_t pi_hash(int64_t const id)
+    {
+        return std::hash<row_id_t>{}(row_id_t{ id });
+    }
+}
+// NOLINTEND(readability-identifier-naming, misc-use-anonymous-namespace)
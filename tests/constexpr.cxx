@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <struct.hxx>
+using namespace pi::tl;
+
+#include <typedecl.hxx>
+
+namespace
+{
+    using record_key_t = pi::td::typedecl<int, TAG(TableKey), pi::td::arithmetic, pi::td::comparison>;
+    using mass_t = pi::td::typedecl<double, TAG(TableMass), pi::td::arithmetic>;
+    using flag_t = pi::td::typedecl<char, TAG(TableFlag)>;
+
+    struct point_t
+    {
+        int x{};
+        int y{};
+
+        constexpr point_t() = default;
+        constexpr point_t(int const x_, int const y_) : x{ x_ }, y{ y_ } {}
+    };
+
+    struct final_point_t final
+    {
+        int x{};
+        int y{};
+    };
+
+    using position_t = pi::td::typedecl<point_t, TAG(TablePosition)>;
+    using final_position_t = pi::td::typedecl<final_point_t, TAG(TableFinalPosition)>;
+
+    size_t constexpr table_size = 10'000U;
+
+    using record_t = struct_t<record_key_t, mass_t, flag_t, position_t>;
+    using constant_record_t = packed_struct_with_consts_t<flag_t, record_key_t const, mass_t const>;
+
+    // Built with the constructor (fields in any order), then changed with set and the assignment operators.
+    auto consteval make_table()
+    {
+        auto table = std::array<record_t, table_size>{};
+        for (auto index = 0; index < static_cast<int>(table_size); ++index)
+        {
+            table[static_cast<size_t>(index)] = record_t{ mass_t{ index * 0.5 }, record_key_t{ index } };
+            table[static_cast<size_t>(index)].set(flag_t{ static_cast<char>('a' + index % 26) });
+            table[static_cast<size_t>(index)].set(position_t{ index, -index });
+        }
+
+        return table;
+    }
+
+    template <size_t ...Indices>
+    auto consteval make_constant_table(std::index_sequence<Indices...>)
+    {
+        return std::array<constant_record_t, sizeof...(Indices)>{ constant_record_t{ flag_t{ 'c' }, record_key_t{ static_cast<int>(Indices) }, mass_t{ static_cast<double>(Indices) } }... };
+    }
+
+    auto constexpr table = make_table();
+    auto constexpr constant_table = make_constant_table(std::make_index_sequence<table_size>{});
+}
+
+SCENARIO("Compile-time tables") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a table of 10'000 structs built at compile time")
+    {
+        THEN("its records are usable in constant expressions")
+        {
+            STATIC_REQUIRE(table.size() == table_size);
+            STATIC_REQUIRE(table[0].get<record_key_t>() == record_key_t{ 0 });
+            STATIC_REQUIRE(table[9'999].get<record_key_t>() == record_key_t{ 9'999 });
+            STATIC_REQUIRE(static_cast<double>(table[4].get<mass_t>()) == 2.0);
+            STATIC_REQUIRE(static_cast<char>(table[27].get<flag_t>()) == 'b');
+            STATIC_REQUIRE(static_cast<point_t>(table[3].get<position_t>()).y == -3);
+            STATIC_REQUIRE(std::is_same_v<decltype(table[0].get<mass_t>()), mass_t const &>);
+        }
+
+        THEN("the structs with constants are usable in constant expressions")
+        {
+            STATIC_REQUIRE(constant_table.size() == table_size);
+            STATIC_REQUIRE(constant_table[9'999].get<record_key_t>() == record_key_t{ 9'999 });
+            STATIC_REQUIRE(static_cast<double>(constant_table[7].get<mass_t const>()) == 7.0);
+            STATIC_REQUIRE(static_cast<char>(constant_table[7].get<flag_t>()) == 'c');
+        }
+    }
+
+    GIVEN("strong types over classes")
+    {
+        THEN("they are constructed, converted and assigned in constant expressions")
+        {
+            STATIC_REQUIRE([] {
+                auto position = position_t{ 1, 2 };
+                position = position_t{ 3, 4 };
+                return static_cast<point_t>(position).x;
+            }() == 3);
+
+            STATIC_REQUIRE([] {
+                auto const position = final_position_t{ final_point_t{ 5, 6 } };
+                return (*position).x + position->y;
+            }() == 11);
+        }
+    }
+}
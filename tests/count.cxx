@@ -178,3 +178,79 @@ SCENARIO("count with relaxed matching strategy") // NOLINT(misc-use-anonymous-na
         }
     }
 }
+
+namespace
+{
+    template <size_t Index>
+    struct element_t {};
+
+    template <matching Strategy, typename SearchedType, size_t Period, size_t ...Indices>
+    auto consteval count_in_large_list(std::index_sequence<Indices...>)
+    {
+        return count<Strategy, SearchedType, element_t<Indices % Period>..., element_t<Indices % Period> const &...>();
+    }
+}
+
+SCENARIO("count with large type lists (no need to raise the template instantiation depth)") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a list of 2048 types and 2048 constant references to types, each made of distinct types repeating in order")
+    {
+        auto constexpr size = std::make_index_sequence<2'048>{};
+
+        THEN("the strict matching strategy counts only the types with the same modifiers")
+        {
+            REQUIRE(count_in_large_list<matching::strict, element_t<0>, 2'048>(size) == 1U);
+            REQUIRE(count_in_large_list<matching::strict, element_t<7> const &, 8>(size) == 256U);
+            REQUIRE(count_in_large_list<matching::strict, element_t<8>, 8>(size) == 0U);
+        }
+
+        THEN("the relaxed matching strategy counts the types regardless of modifiers")
+        {
+            REQUIRE(count_in_large_list<matching::relaxed, element_t<0>, 2'048>(size) == 2U);
+            REQUIRE(count_in_large_list<matching::relaxed, element_t<7>, 8>(size) == 512U);
+        }
+    }
+}
+
+SCENARIO("count_each and contains_only") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("an empty list of searched types or an empty type list")
+    {
+        THEN("count_each returns an array of zeros and contains_only is true only for an empty type list")
+        {
+            STATIC_REQUIRE(count_each<typelist<>, int, char>().empty());
+            STATIC_REQUIRE(count_each<typelist<int, char>>() == std::array<size_t, 2>{ 0U, 0U });
+            STATIC_REQUIRE(contains_only<typelist<>>());
+            STATIC_REQUIRE(contains_only<typelist<int>>());
+            STATIC_REQUIRE_FALSE(contains_only<typelist<>, int>());
+        }
+    }
+
+    GIVEN("a list of searched types and a type list with several 'variations' of them")
+    {
+        THEN("count_each returns the same counts as count, for each searched type")
+        {
+            STATIC_REQUIRE(count_each<matching::strict, typelist<int, char const, double>, int, char, int const, char const, int, float>()
+                           == std::array<size_t, 3>{ 2U, 1U, 0U });
+            STATIC_REQUIRE(count_each<typelist<int, char const, double>, int, char, int const, char const, int, float>()
+                           == std::array<size_t, 3>{ count<int, int, char, int const, char const, int, float>()
+                                                   , count<char const, int, char, int const, char const, int, float>()
+                                                   , count<double, int, char, int const, char const, int, float>() });
+        }
+
+        THEN("a type is counted for every searched type it matches, as count does")
+        {
+            STATIC_REQUIRE(count_each<typelist<int, int const>, int, int const>()
+                           == std::array<size_t, 2>{ count<int, int, int const>(), count<int const, int, int const>() });
+            STATIC_REQUIRE(count_each<typelist<int, int const>, int, int const>() == std::array<size_t, 2>{ 2U, 2U });
+            STATIC_REQUIRE(count_each<matching::strict, typelist<int, int const>, int, int const>() == std::array<size_t, 2>{ 1U, 1U });
+        }
+
+        THEN("contains_only is true only if all types in the type list match one of the searched types")
+        {
+            STATIC_REQUIRE(contains_only<typelist<int, char>, int, char const &, int &&, char>());
+            STATIC_REQUIRE_FALSE(contains_only<typelist<int, char>, int, char, float>());
+            STATIC_REQUIRE_FALSE(contains_only<matching::strict, typelist<int, char>, int, char const &>());
+        }
+    }
+}
@@ -0,0 +1,163 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using namespace Catch::Matchers;
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <dynamic_struct.hxx>
+using namespace pi::tl;
+
+#include <toolbox.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, pi::td::tag<"dynamic.x">>;
+    using y_t = pi::td::typedecl<double, pi::td::tag<"dynamic.y">>;
+    using hp_t = pi::td::typedecl<int, pi::td::tag<"dynamic.hp">>;
+    using name_t = pi::td::typedecl<std::string, pi::td::tag<"dynamic.name">>;
+    using owner_t = pi::td::typedecl<std::unique_ptr<int>, pi::td::tag<"dynamic.owner">>;
+
+    template <int Index>
+    using field_t = pi::td::typedecl<int, std::integral_constant<int, Index>>;
+}
+
+SCENARIO("Dynamic struct")
+{
+    GIVEN("A dynamic struct with a few fields, small and trivially copyable or not")
+    {
+        dynamic_struct npc;
+        npc.set(x_t{ 1.0 });
+        npc.set(name_t{ "Alice" });
+        npc.emplace<hp_t>(100);
+
+        THEN("The fields are looked up by type")
+        {
+            REQUIRE(npc.size() == 3U);
+            REQUIRE_THAT(npc.get<x_t>(), WithinAbs(1.0, pi::epsilon<double>));
+            REQUIRE(npc.get<name_t>() == "Alice");
+            REQUIRE(npc.get<hp_t>() == 100);
+            REQUIRE(npc.find<y_t>() == nullptr);
+            REQUIRE_FALSE(npc.contains<y_t>());
+            REQUIRE_THROWS_AS(npc.get<y_t>(), std::out_of_range);
+        }
+
+        THEN("Setting a field that exists assigns it, erasing one keeps the others")
+        {
+            npc.set(hp_t{ 50 });
+            REQUIRE(npc.size() == 3U);
+            REQUIRE(npc.get<hp_t>() == 50);
+
+            REQUIRE(npc.erase<x_t>());
+            REQUIRE_FALSE(npc.erase<x_t>());
+            REQUIRE(npc.size() == 2U);
+            REQUIRE(npc.get<name_t>() == "Alice");
+            REQUIRE(npc.get<hp_t>() == 50);
+        }
+
+        THEN("Emplacing a field that exists constructs the new one before destroying the old one")
+        {
+            npc.emplace<name_t>(npc.get<name_t>());
+            npc.emplace<x_t>(npc.get<x_t>() + 1.0);
+            REQUIRE(npc.size() == 3U);
+            REQUIRE(npc.get<name_t>() == "Alice");
+            REQUIRE_THAT(npc.get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+
+            REQUIRE_THROWS_AS(npc.emplace<name_t>(std::string{}.max_size() + 1U, 'a'), std::length_error);
+            REQUIRE(npc.size() == 3U);
+            REQUIRE(npc.get<name_t>() == "Alice");
+            REQUIRE_THROWS_AS(npc.emplace<y_t>(npc.get<y_t>()), std::out_of_range);
+            REQUIRE_FALSE(npc.contains<y_t>());
+        }
+
+        THEN("Copies are deep, moves leave the source empty")
+        {
+            auto copy = npc;
+            copy.get<name_t>() = name_t{ "Bob" };
+            REQUIRE(npc.get<name_t>() == "Alice");
+
+            auto const moved = std::move(copy);
+            REQUIRE(copy.empty()); // NOLINT(bugprone-use-after-move)
+            REQUIRE(moved.get<name_t>() == "Bob");
+        }
+
+        THEN("It converts to a struct with the same fields only")
+        {
+            auto record = npc.as<struct_t<hp_t, name_t, x_t>>();
+            REQUIRE(record.get<name_t>() == "Alice");
+            REQUIRE(record.get<hp_t>() == 100);
+            REQUIRE_THROWS_AS((npc.as<struct_t<hp_t, x_t>>()), std::invalid_argument);
+            REQUIRE_THROWS_AS((npc.as<struct_t<hp_t, x_t, y_t>>()), std::invalid_argument);
+        }
+    }
+
+    GIVEN("A struct")
+    {
+        auto const record = packed_struct_t<x_t, hp_t, y_t>{ x_t{ 1.0 }, y_t{ 2.0 }, hp_t{ 3 } };
+
+        THEN("A dynamic struct holds a copy of its fields, and converts back")
+        {
+            dynamic_struct npc{ record };
+            REQUIRE(npc.size() == 3U);
+            REQUIRE_THAT(npc.get<y_t>(), WithinAbs(2.0, pi::epsilon<double>));
+
+            npc.set(hp_t{ 4 });
+            auto back = npc.as<packed_struct_t<x_t, hp_t, y_t>>();
+            REQUIRE(back.get<hp_t>() == 4);
+            REQUIRE_THAT(back.get<x_t>(), WithinAbs(1.0, pi::epsilon<double>));
+        }
+    }
+
+    GIVEN("Many fields, which collide in the table")
+    {
+        dynamic_struct many;
+        [&many]<int ...Indices>(std::integer_sequence<int, Indices...>)
+        {
+            (many.set(field_t<Indices>{ Indices }), ...);
+        }(std::make_integer_sequence<int, 40>{});
+
+        THEN("They are all found, and erasing some keeps the others reachable")
+        {
+            REQUIRE(many.size() == 40U);
+            REQUIRE(many.get<field_t<0>>() == 0);
+            REQUIRE(many.get<field_t<39>>() == 39);
+
+            [&many]<int ...Indices>(std::integer_sequence<int, Indices...>)
+            {
+                (many.erase<field_t<Indices * 2>>(), ...);
+            }(std::make_integer_sequence<int, 20>{});
+
+            REQUIRE(many.size() == 20U);
+            [&many]<int ...Indices>(std::integer_sequence<int, Indices...>)
+            {
+                REQUIRE(((many.get<field_t<Indices * 2 + 1>>() == Indices * 2 + 1) && ...));
+                REQUIRE(((many.find<field_t<Indices * 2>>() == nullptr) && ...));
+            }(std::make_integer_sequence<int, 20>{});
+        }
+    }
+
+    GIVEN("A field that cannot be copied")
+    {
+        dynamic_struct owner;
+        owner.emplace<owner_t>(new int{ 42 });
+
+        THEN("It can be moved, not copied")
+        {
+            REQUIRE(*owner.get<owner_t>().get() == 42);
+            REQUIRE_THROWS_AS(dynamic_struct{ owner }, std::invalid_argument);
+
+            auto copy = dynamic_struct{};
+            copy.set(hp_t{ 7 });
+            REQUIRE_THROWS_AS(copy = owner, std::invalid_argument);
+            REQUIRE(copy.size() == 1U);
+            REQUIRE(copy.get<hp_t>() == 7);
+
+            auto const moved = std::move(owner);
+            REQUIRE(*moved.get<owner_t>().get() == 42);
+        }
+    }
+}
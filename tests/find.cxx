@@ -346,3 +346,85 @@ SCENARIO("find_nth") // NOLINT(misc-use-anonymous-namespace)
         }
     }
 }
+
+namespace
+{
+    template <size_t Index>
+    struct element_t {};
+
+    template <matching Strategy, typename SearchedType, size_t Nth, size_t Period, bool Constant = false, size_t ...Indices>
+    auto consteval find_nth_in_large_list(std::index_sequence<Indices...>)
+    {
+        return find_nth<Strategy, SearchedType, Nth, std::conditional_t<Constant, element_t<Indices % Period> const, element_t<Indices % Period>>...>();
+    }
+}
+
+SCENARIO("find and find_nth with large type lists (no need to raise the template instantiation depth)") // NOLINT(misc-use-anonymous-namespace)
+{
+    auto constexpr size = std::make_index_sequence<4'096>{};
+
+    GIVEN("a list of 4096 distinct types")
+    {
+        THEN("the first, a middle and the last type are found at their index")
+        {
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<0>, 1, 4'096>(size) == 0);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<1'999>, 1, 4'096>(size) == 1'999);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<4'095>, 1, 4'096>(size) == 4'095);
+        }
+
+        THEN("a type that is not in the list is not found")
+        {
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<4'096>, 1, 4'096>(size) == npos);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<0>, 2, 4'096>(size) == npos);
+        }
+    }
+
+    GIVEN("a list of 4096 types made of 10 distinct types repeating in order")
+    {
+        THEN("the nth instance of a type is found at its index")
+        {
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<3>, 1, 10>(size) == 3);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<3>, 2, 10>(size) == 13);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<3>, 400, 10>(size) == 3'993);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<9>, 409, 10>(size) == 4'089);
+        }
+
+        THEN("there are not that many instances of a type")
+        {
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<9>, 410, 10>(size) == npos);
+        }
+    }
+
+    GIVEN("a list of 4096 constant types made of 10 distinct types repeating in order")
+    {
+        THEN("the types are found only using the relaxed matching strategy")
+        {
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<5>, 2, 10, true>(size) == npos);
+            REQUIRE(find_nth_in_large_list<matching::relaxed, element_t<5>, 2, 10, true>(size) == 15);
+            REQUIRE(find_nth_in_large_list<matching::strict, element_t<5> const, 2, 10, true>(size) == 15);
+        }
+    }
+}
+
+SCENARIO("find_each") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a list of searched types and a type list with several 'variations' of them")
+    {
+        THEN("find_each returns the same indices as find, for each searched type")
+        {
+            STATIC_REQUIRE(find_each<matching::strict, typelist<int, char const, double>, int const, char, int, char const, int>()
+                           == std::array<int64_t, 3>{ 2, 3, npos });
+            STATIC_REQUIRE(find_each<typelist<int, char const, double>, int const, char, int, char const, int>()
+                           == std::array<int64_t, 3>{ find<int, int const, char, int, char const, int>()
+                                                    , find<char const, int const, char, int, char const, int>()
+                                                    , find<double, int const, char, int, char const, int>() });
+        }
+
+        THEN("a type is found for every searched type it matches, as find does")
+        {
+            STATIC_REQUIRE(find_each<typelist<int, int const>, int const, int>()
+                           == std::array<int64_t, 2>{ find<int, int const, int>(), find<int const, int const, int>() });
+            STATIC_REQUIRE(find_each<typelist<int, int const>, int const, int>() == std::array<int64_t, 2>{ 0, 0 });
+        }
+    }
+}
@@ -91,6 +91,65 @@ SCENARIO("get (index known at run time)") // NOLINT(misc-use-anonymous-namespace
     }
 }
 
+SCENARIO("get_variant and visit_at (index known at run time, arguments of unrelated types)") // NOLINT(misc-use-anonymous-namespace)
+{
+    using namespace std::string_literals;
+
+    GIVEN("a type list with N arguments of unrelated types")
+    {
+        THEN("get_variant(M, ...), M >= N and visit_at(M, ...), M >= N throw an out_of_range exception")
+        {
+            REQUIRE_THROWS_AS(get_variant(3ULL, 1, "two"s, 3.0), std::out_of_range);
+            REQUIRE_THROWS_AS(visit_at(3ULL, [](auto const &) { return 0; }, 1, "two"s, 3.0), std::out_of_range);
+        }
+
+        THEN("get_variant(M, ...), M < N returns a variant holding the argument in the alternative with index M")
+        {
+            auto const variant = get_variant(1ULL, 1, "two"s, 3.0, "four"s);
+            REQUIRE(variant.index() == 1ULL);
+            REQUIRE(std::get<1>(variant) == "two"s);
+            REQUIRE(std::get<3>(get_variant(3ULL, 1, "two"s, 3.0, "four"s)) == "four"s);
+        }
+
+        THEN("visit_at(M, ...), M < N invokes the visitor with the argument at index M, without copying it")
+        {
+            auto const one = 1;
+            auto const two = "two"s;
+            auto const address_of = [](auto const &argument) { return static_cast<void const *>(&argument); };
+            REQUIRE(visit_at(0ULL, address_of, one, two) == &one);
+            REQUIRE(visit_at(1ULL, address_of, one, two) == &two);
+
+            auto const size_of = [](auto const &argument) { return sizeof(argument); };
+            REQUIRE(visit_at(2ULL, size_of, 'c', 1, 2.0) == sizeof(double));
+        }
+    }
+}
+
+namespace
+{
+    template <size_t ...Indices>
+    [[nodiscard]] auto get_from_large_list(size_t const index, std::index_sequence<Indices...>)
+    {
+        return get(index, static_cast<int>(Indices)...);
+    }
+}
+
+SCENARIO("get with large type lists (index known at run time)") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a list of 1024 arguments")
+    {
+        auto constexpr size = std::make_index_sequence<1'024>{};
+
+        THEN("get returns any argument and throws for indices that are out of range")
+        {
+            REQUIRE(get_from_large_list(0ULL, size) == 0);
+            REQUIRE(get_from_large_list(517ULL, size) == 517);
+            REQUIRE(get_from_large_list(1'023ULL, size) == 1'023);
+            REQUIRE_THROWS_AS(get_from_large_list(1'024ULL, size), std::out_of_range);
+        }
+    }
+}
+
 SCENARIO("get_or_initialize with strict matching strategy") // NOLINT(misc-use-anonymous-namespace)
 {
     GIVEN("a default value and a list of arguments")
@@ -139,6 +198,62 @@ SCENARIO("get_or_initialize with relaxed matching strategy") // NOLINT(misc-use-
     }
 }
 
+SCENARIO("get_or_invoke and get_nth_or_invoke") // NOLINT(misc-use-anonymous-namespace)
+{
+    using namespace std::string_literals;
+
+    GIVEN("a default factory and a list of arguments")
+    {
+        auto number_of_calls = 0;
+        auto const make_default = [&number_of_calls] { ++number_of_calls; return "default"s; };
+
+        THEN("the factory is invoked only if there is no matching argument")
+        {
+            REQUIRE(get_or_invoke(make_default) == "default"s);
+            REQUIRE(get_or_invoke(make_default, 1, 2.0) == "default"s);
+            REQUIRE(get_nth_or_invoke<2>(make_default, 1, "one"s) == "default"s);
+            REQUIRE(number_of_calls == 3);
+
+            REQUIRE(get_or_invoke(make_default, 1, "one"s) == "one"s);
+            REQUIRE(get_nth_or_invoke<2>(make_default, "one"s, 2, "two"s) == "two"s);
+            REQUIRE(number_of_calls == 3);
+        }
+
+        THEN("a matching lvalue is returned by reference, not copied")
+        {
+            auto const one = "one"s;
+            auto two = "two"s;
+            auto const &first = get_or_invoke(make_default, 1, one, two);
+            auto &second = get_nth_or_invoke<2>(make_default, 1, one, two);
+            REQUIRE(&first == &one);
+            REQUIRE(&second == &two);
+            REQUIRE(number_of_calls == 0);
+        }
+
+        THEN("a matching rvalue is moved into the result, which does not dangle")
+        {
+            auto two = "two"s;
+            STATIC_REQUIRE(std::is_same_v<decltype(get_or_invoke(make_default, 1, std::move(two))), std::string>);
+            STATIC_REQUIRE(std::is_same_v<decltype(get_nth_or_invoke<2>(make_default, "one"s, "two"s)), std::string>);
+
+            decltype(auto) first = get_or_invoke(make_default, 1, "one"s);
+            auto &&second = get_nth_or_invoke<2>(make_default, "one"s, std::move(two));
+            REQUIRE(first == "one"s);
+            REQUIRE(second == "two"s);
+            REQUIRE(number_of_calls == 0);
+        }
+
+        THEN("the matching strategy is respected")
+        {
+            auto const one = "one"s;
+            REQUIRE(get_or_invoke<matching::strict>(make_default, one, "two"s) == "two"s);
+            REQUIRE(get_nth_or_invoke<matching::strict, 2>(make_default, one, "two"s) == "default"s);
+            REQUIRE(get_nth_or_invoke<matching::relaxed, 2>(make_default, one, "two"s) == "two"s);
+            REQUIRE(number_of_calls == 1);
+        }
+    }
+}
+
 SCENARIO("get_nth_or_initialize with strict matching strategy (compile time)") // NOLINT(misc-use-anonymous-namespace)
 {
     GIVEN("a default value, a list of arguments and the index 1 (at compile time)")
@@ -348,3 +463,29 @@ SCENARIO("get_nth_or_initialize with relaxed matching strategy (run time)") // N
         }
     }
 }
+
+namespace
+{
+    template <size_t ...Indices>
+    [[nodiscard]] auto get_nth_int_from_large_list(size_t const nth, std::index_sequence<Indices...>)
+    {
+        return get_nth_or_initialize<matching::strict>(nth, -1, std::conditional_t<Indices % 2U == 0U, int, double>(Indices)...);
+    }
+}
+
+SCENARIO("get_nth_or_initialize with large type lists (run time)") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("a list of 512 arguments, alternating int and double")
+    {
+        auto constexpr size = std::make_index_sequence<512>{};
+
+        THEN("the nth int is returned, or the default if there are not that many")
+        {
+            REQUIRE(get_nth_int_from_large_list(1ULL, size) == 0);
+            REQUIRE(get_nth_int_from_large_list(100ULL, size) == 198);
+            REQUIRE(get_nth_int_from_large_list(256ULL, size) == 510);
+            REQUIRE(get_nth_int_from_large_list(257ULL, size) == -1);
+            REQUIRE(get_nth_int_from_large_list(0ULL, size) == -1);
+        }
+    }
+}
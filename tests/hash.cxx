@@ -0,0 +1,129 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <struct.hxx>
+using namespace pi::tl;
+
+#include <typedecl.hxx>
+
+namespace
+{
+    using row_id_t = pi::td::typedecl<int64_t, TAG(HashRowId), pi::td::comparison>;
+    using column_t = pi::td::typedecl<int32_t, TAG(HashColumn)>;
+    using weight_t = pi::td::typedecl<double, TAG(HashWeight)>;
+    using name_t = pi::td::typedecl<std::string, TAG(HashName)>;
+
+    struct not_hashable_t
+    {
+        int value{};
+    };
+
+    // Fields of scalars without padding: hashed in a single pass over the bytes.
+    using cell_t = struct_t<row_id_t, column_t, column_t>;
+    // A floating point and a string: the hashes of the fields are combined.
+    using entry_t = struct_t<name_t, weight_t>;
+    using constant_cell_t = struct_with_consts_t<row_id_t const, column_t>;
+}
+
+SCENARIO("Hashing strong types") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("typedecls of hashable and of unhashable types")
+    {
+        THEN("only those over a hashable type have a std::hash")
+        {
+            STATIC_REQUIRE(pi::td::internal::is_hashable_v<row_id_t>);
+            STATIC_REQUIRE(pi::td::internal::is_hashable_v<name_t>);
+            STATIC_REQUIRE(!pi::td::internal::is_hashable_v<pi::td::typedecl<not_hashable_t, TAG(HashNotHashable)>>);
+            STATIC_REQUIRE(!pi::td::internal::is_hashable_v<struct_t<row_id_t, not_hashable_t>>);
+        }
+
+        THEN("they have the hash of their underlying value")
+        {
+            REQUIRE(std::hash<row_id_t>{}(row_id_t{ 42 }) == std::hash<int64_t>{}(42));
+            REQUIRE(std::hash<row_id_t>{}(row_id_t{ 42 }) != std::hash<row_id_t>{}(row_id_t{ 43 }));
+            REQUIRE(std::hash<weight_t>{}(weight_t{ -0.0 }) == std::hash<weight_t>{}(weight_t{ 0.0 }));
+            REQUIRE(std::hash<name_t>{}(name_t{ "left" }) == std::hash<std::string>{}("left"));
+        }
+    }
+
+    GIVEN("tables keyed by strong types, with the transparent hasher")
+    {
+        auto rows = std::unordered_map<row_id_t, int, pi::td::transparent_hash, std::equal_to<>>{};
+        auto names = std::unordered_set<name_t, pi::td::transparent_hash, std::equal_to<>>{};
+        for (auto id = int64_t{ 0 }; id < 1'000; ++id)
+            rows.emplace(row_id_t{ id }, static_cast<int>(id) * 2);
+        names.emplace("left");
+        names.emplace("right");
+
+        THEN("a strong type and its underlying value have the same hash")
+        {
+            REQUIRE(pi::td::transparent_hash{}(row_id_t{ 7 }) == pi::td::transparent_hash{}(int64_t{ 7 }));
+            REQUIRE(pi::td::transparent_hash{}(row_id_t{ 7 }) == std::hash<row_id_t>{}(row_id_t{ 7 }));
+            REQUIRE(pi::td::transparent_hash{}(name_t{ "left" }) == pi::td::transparent_hash{}(std::string_view{ "left" }));
+        }
+
+        THEN("they are searched with the underlying value, without building a key")
+        {
+            REQUIRE(rows.find(int64_t{ 500 })->second == 1'000);
+            REQUIRE(rows.find(row_id_t{ 999 })->second == 1'998);
+            REQUIRE(!rows.contains(int64_t{ 1'000 }));
+            REQUIRE(names.contains(std::string_view{ "right" }));
+            REQUIRE(!names.contains(std::string_view{ "middle" }));
+        }
+    }
+}
+
+SCENARIO("Hashing structs") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("structs whose equal values have the same bytes, and structs whose do not")
+    {
+        THEN("the first are hashed as bytes, the others field by field")
+        {
+            STATIC_REQUIRE(internal::is_hashed_as_bytes_v<cell_t, row_id_t, column_t, column_t>);
+            STATIC_REQUIRE(!internal::is_hashed_as_bytes_v<entry_t, name_t, weight_t>);
+            STATIC_REQUIRE(!internal::is_hashed_as_bytes_v<struct_t<weight_t>, weight_t>);
+            STATIC_REQUIRE(!internal::is_hashed_as_bytes_v<struct_t<column_t, row_id_t>, column_t, row_id_t>);
+        }
+
+        THEN("equal structs have equal hashes")
+        {
+            auto const cell = cell_t{ row_id_t{ 3 }, column_t{ 4 }, column_t{ 5 } };
+            REQUIRE(cell == cell_t{ column_t{ 4 }, row_id_t{ 3 }, column_t{ 5 } });
+            REQUIRE(std::hash<cell_t>{}(cell) == std::hash<cell_t>{}(cell_t{ column_t{ 4 }, row_id_t{ 3 }, column_t{ 5 } }));
+            REQUIRE(std::hash<cell_t>{}(cell) != std::hash<cell_t>{}(cell_t{ row_id_t{ 3 }, column_t{ 5 }, column_t{ 4 } }));
+
+            auto const entry = entry_t{ name_t{ "weight" }, weight_t{ 0.0 } };
+            REQUIRE(entry == entry_t{ name_t{ "weight" }, weight_t{ -0.0 } });
+            REQUIRE(std::hash<entry_t>{}(entry) == std::hash<entry_t>{}(entry_t{ name_t{ "weight" }, weight_t{ -0.0 } }));
+            REQUIRE(std::hash<entry_t>{}(entry) != std::hash<entry_t>{}(entry_t{ name_t{ "weight" }, weight_t{ 1.0 } }));
+
+            auto const constant_cell = constant_cell_t{ row_id_t{ 1 }, column_t{ 2 } };
+            REQUIRE(constant_cell == constant_cell_t{ row_id_t{ 1 }, column_t{ 2 } });
+            REQUIRE(std::hash<constant_cell_t>{}(constant_cell) == std::hash<constant_cell_t>{}(constant_cell_t{ row_id_t{ 1 }, column_t{ 2 } }));
+        }
+
+        THEN("they are keys of unordered containers")
+        {
+            auto cells = std::unordered_set<cell_t>{};
+            for (auto row = int64_t{ 0 }; row < 100; ++row)
+                for (auto column = 0; column < 10; ++column)
+                    cells.emplace(row_id_t{ row }, column_t{ column }, column_t{ column });
+
+            REQUIRE(cells.size() == 1'000U);
+            REQUIRE(cells.contains(cell_t{ row_id_t{ 99 }, column_t{ 9 }, column_t{ 9 } }));
+            REQUIRE(!cells.contains(cell_t{ row_id_t{ 99 }, column_t{ 9 }, column_t{ 8 } }));
+
+            auto entries = std::unordered_map<entry_t, int>{};
+            entries[entry_t{ name_t{ "left" }, weight_t{ 0.5 } }] = 1;
+            entries[entry_t{ name_t{ "left" }, weight_t{ 0.5 } }] += 1;
+            REQUIRE(entries.size() == 1U);
+            REQUIRE(entries.begin()->second == 2);
+        }
+    }
+}
@@ -24,12 +24,13 @@ namespace
     template <typename ...TypeList>
     auto validate_npc()
     {
-        auto constexpr number_of_strings = count<std::string, TypeList...>();
-        auto constexpr number_of_doubles = count<double, TypeList...>();
-        auto constexpr number_of_ints = count<int, TypeList...>();
-        auto constexpr number_of_arguments = sizeof...(TypeList);
+        using accepted_types_t = typelist<std::string, double, int>;
+        auto constexpr counts = count_each<accepted_types_t, TypeList...>();
+        auto constexpr number_of_strings = counts[0];
+        auto constexpr number_of_doubles = counts[1];
+        auto constexpr number_of_ints = counts[2];
 
-        static_assert(number_of_strings + number_of_doubles + number_of_ints == number_of_arguments,
+        static_assert(contains_only<accepted_types_t, TypeList...>(),
                       "Unexpected argument(s). Accepted arguments are (up to): 1·std::string (name), 3·doubles (x, y, z - position), 1·int (health points).");
         static_assert(number_of_strings <= 1ULL, "Too many std::string arguments. At most one is expected: the name of the NPC.");
         static_assert(number_of_doubles <= 3ULL, "Too many double arguments. At most three are expected: x, y and z (the position of the NPC, in this order).");
@@ -74,12 +74,13 @@ namespace
     template <typename ...TypeList>
     auto validate_player()
     {
-        auto constexpr number_of_names = count<name_t, TypeList...>();
-        auto constexpr number_of_xs = count<x_t, TypeList...>();
-        auto constexpr number_of_ys = count<y_t, TypeList...>();
-        auto constexpr number_of_zs = count<z_t, TypeList...>();
-        auto constexpr number_of_healths = count<health_t, TypeList...>();
-        auto constexpr number_of_arguments = sizeof...(TypeList);
+        auto constexpr arguments = typelist<TypeList...>{};
+        auto constexpr number_of_names = count<name_t>(arguments);
+        auto constexpr number_of_xs = count<x_t>(arguments);
+        auto constexpr number_of_ys = count<y_t>(arguments);
+        auto constexpr number_of_zs = count<z_t>(arguments);
+        auto constexpr number_of_healths = count<health_t>(arguments);
+        auto constexpr number_of_arguments = decltype(arguments)::size;
 
         static_assert(number_of_names + number_of_xs + number_of_ys + number_of_zs + number_of_healths == number_of_arguments,
                       "Unexpected argument type. Accepted argument types are: name_t, x_t, y_t, z_t and health_t.");
@@ -137,6 +138,30 @@ namespace
 
         return player;
     }
+
+    /*!
+    * @brief Initialize player 3; the defaults are only made if there is no matching argument.
+    * Accepted arguments (in any combination - number and order):
+    * - name [default "Player 3"]: name_t
+    * - x [default 0.0]: x_t
+    * - y [default 0.0]: y_t
+    * - z [default 0.0]: z_t
+    * - hp [default 300]: health_t
+    */
+    template <typename ...TypeList>
+    [[maybe_unused]] auto initialize3([[maybe_unused]] TypeList &&...arguments)
+    {
+        validate_player<TypeList...>();
+
+        player_t player{};
+        player.name = get_or_invoke([] { return "Player 3"_name; }, std::forward<TypeList>(arguments)...);
+        player.x = get_or_invoke([] { return 0.0_x; }, std::forward<TypeList>(arguments)...);
+        player.y = get_or_invoke([] { return 0.0_y; }, std::forward<TypeList>(arguments)...);
+        player.z = get_or_invoke([] { return 0.0_z; }, std::forward<TypeList>(arguments)...);
+        player.hp = get_or_invoke([] { return 300_hp; }, std::forward<TypeList>(arguments)...);
+
+        return player;
+    }
 }
 
 SCENARIO("sandbox (Player)") // NOLINT(misc-use-anonymous-namespace)
@@ -269,6 +294,24 @@ SCENARIO("sandbox (Player)") // NOLINT(misc-use-anonymous-namespace)
             REQUIRE_THAT(player2.z, WithinAbs(1.0, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
             REQUIRE(player2.hp == 0);
         }
+
+        THEN("the defaults made by a factory are used only for the missing arguments")
+        {
+            auto const player3 = initialize3();
+            REQUIRE(player3.name == "Player 3"_name);
+            REQUIRE_THAT(player3.x, WithinAbs(0.0_x, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE_THAT(player3.y, WithinAbs(0.0_y, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE_THAT(player3.z, WithinAbs(0.0_z, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE(player3.hp == 300_hp);
+
+            auto const name = "Robin"_name;
+            auto const player = initialize3(1_y, name, 30_hp);
+            REQUIRE(player.name == "Robin"_name);
+            REQUIRE_THAT(player.x, WithinAbs(0.0_x, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE_THAT(player.y, WithinAbs(1.0_y, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE_THAT(player.z, WithinAbs(0.0_z, pi::epsilon<double>)); // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+            REQUIRE(player.hp == 30_hp);
+        }
     }
 
     GIVEN("a safe type over a class or structure declared as final")
@@ -0,0 +1,225 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using namespace Catch::Matchers;
+
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <simd.hxx>
+#include <struct_vector.hxx>
+
+#include <toolbox.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, TAG(SimdX)>;
+    using y_t = pi::td::typedecl<double, TAG(SimdY)>;
+    using mass_t = pi::td::typedecl<float, TAG(SimdMass)>;
+    using hp_t = pi::td::typedecl<int, TAG(SimdHP)>;
+
+    template <typename Left, typename Right>
+    concept addable = requires(std::vector<Left> left, std::vector<Right> right) { pi::td::simd::add(left, right, left); };
+
+    // 37 is not a multiple of any vector width, so both the vector and the scalar loops are exercised
+    auto constexpr size = size_t{ 37 };
+
+    template <typename Type>
+    auto make_column(double const first, double const step)
+    {
+        auto column = std::vector<Type>{};
+        for (auto index = size_t{ 0 }; index < size; ++index)
+            column.emplace_back(static_cast<typename Type::value_type>(first + step * static_cast<double>(index)));
+
+        return column;
+    }
+}
+
+namespace
+{
+    // Checks every kernel against the scalar operations for each size in [0, 40): the sizes below, at and above one or
+    // several vector widths (4 and 8 doubles, 8 and 16 floats) exercise the vector loop, the scalar tail and both.
+    template <typename Strong>
+    void check_against_scalar()
+    {
+        using value_t = typename Strong::value_type;
+        using scalar = pi::td::internal::scalar_operations;
+        auto const tolerance = static_cast<double>(pi::epsilon<value_t>) * 64.0;
+
+        for (auto count = size_t{ 0 }; count < 40U; ++count)
+        {
+            auto left = std::vector<Strong>{};
+            auto right = std::vector<Strong>{};
+            for (auto index = size_t{ 0 }; index < count; ++index)
+            {
+                left.emplace_back(static_cast<value_t>(std::sin(static_cast<double>(index)) * 8.0));
+                right.emplace_back(static_cast<value_t>(2.0 + std::cos(static_cast<double>(index))));
+            }
+
+            auto output = std::vector<Strong>(count);
+            pi::td::simd::fma(left, right, left, output);
+            for (auto index = size_t{ 0 }; index < count; ++index)
+                REQUIRE_THAT(static_cast<double>(output[index]), WithinAbs(scalar::fma<value_t>(left[index], right[index], left[index]), tolerance * 8.0));
+
+            pi::td::simd::divide(left, right, output);
+            for (auto index = size_t{ 0 }; index < count; ++index)
+                REQUIRE(static_cast<value_t>(output[index]) == static_cast<value_t>(left[index] / right[index]));
+
+            pi::td::simd::min(left, right, output);
+            for (auto index = size_t{ 0 }; index < count; ++index)
+                REQUIRE(static_cast<value_t>(output[index]) == scalar::min<value_t>(left[index], right[index]));
+
+            pi::td::simd::clamp(left, Strong{ value_t{ -2 } }, Strong{ value_t{ 3 } }, output);
+            for (auto index = size_t{ 0 }; index < count; ++index)
+                REQUIRE(static_cast<value_t>(output[index]) == std::clamp<value_t>(left[index], value_t{ -2 }, value_t{ 3 }));
+
+            auto total = 0.0;
+            auto minimum = count == 0U ? value_t{} : static_cast<value_t>(left[0]);
+            auto maximum = minimum;
+            for (auto const value : left)
+            {
+                total += static_cast<double>(value);
+                minimum = scalar::min<value_t>(minimum, value);
+                maximum = scalar::max<value_t>(maximum, value);
+            }
+
+            REQUIRE_THAT(static_cast<double>(pi::td::simd::sum(left)), WithinAbs(total, tolerance * 8.0 * static_cast<double>(count + 1U)));
+            if (count > 0U)
+            {
+                REQUIRE(static_cast<value_t>(pi::td::simd::minimum(left)) == minimum);
+                REQUIRE(static_cast<value_t>(pi::td::simd::maximum(left)) == maximum);
+            }
+        }
+    }
+}
+
+SCENARIO("SIMD kernels against the scalar operations") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("The instruction set the tests are built for (see the tests_avx2 and tests_avx512 targets)")
+    {
+        THEN("float and double use the vector registers exactly when AVX2 or AVX-512 is enabled")
+        {
+#if defined(__AVX512F__)
+            STATIC_REQUIRE(pi::td::internal::vector_operations<double>::width == 8U);
+            STATIC_REQUIRE(pi::td::internal::vector_operations<float>::width == 16U);
+#elif defined(__AVX2__)
+            STATIC_REQUIRE(pi::td::internal::vector_operations<double>::width == 4U);
+            STATIC_REQUIRE(pi::td::internal::vector_operations<float>::width == 8U);
+#else
+            STATIC_REQUIRE_FALSE(pi::td::internal::vector_operations<double>::enabled);
+            STATIC_REQUIRE_FALSE(pi::td::internal::vector_operations<float>::enabled);
+#endif
+        }
+
+        THEN("Each kernel gives the result of the scalar loop, for every size around the vector widths")
+        {
+            check_against_scalar<x_t>();
+            check_against_scalar<mass_t>();
+        }
+    }
+}
+
+SCENARIO("SIMD kernels over columns of typedecls")
+{
+    GIVEN("Columns of strong types")
+    {
+        THEN("Only columns of the same strong type can be combined")
+        {
+            STATIC_REQUIRE(addable<x_t, x_t>);
+            STATIC_REQUIRE_FALSE(addable<x_t, y_t>);
+            STATIC_REQUIRE_FALSE(pi::td::simd::column<std::vector<double>>);
+        }
+    }
+
+    GIVEN("Two columns of doubles")
+    {
+        auto const left = make_column<x_t>(1.0, 0.5);
+        auto const right = make_column<x_t>(-4.0, 0.25);
+        auto output = std::vector<x_t>(size);
+
+        THEN("The element-wise operations match the scalar ones")
+        {
+            pi::td::simd::add(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] + right[index], pi::epsilon<double>));
+
+            pi::td::simd::subtract(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] - right[index], pi::epsilon<double>));
+
+            pi::td::simd::multiply(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] * right[index], pi::epsilon<double>));
+
+            pi::td::simd::divide(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinRel(left[index] / right[index]));
+
+            pi::td::simd::fma(left, right, left, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] * right[index] + left[index], pi::epsilon<double> * 16.0));
+
+            pi::td::simd::min(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] < right[index] ? left[index] : right[index], pi::epsilon<double>));
+
+            pi::td::simd::max(left, right, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(left[index] > right[index] ? left[index] : right[index], pi::epsilon<double>));
+
+            pi::td::simd::clamp(right, x_t{ -1.0 }, x_t{ 2.0 }, output);
+            for (auto index = size_t{ 0 }; index < size; ++index)
+                REQUIRE_THAT(output[index], WithinAbs(std::clamp<double>(right[index], -1.0, 2.0), pi::epsilon<double>));
+        }
+
+        THEN("The reductions match the scalar ones and keep the strong type")
+        {
+            auto const total = pi::td::simd::sum(left);
+            STATIC_REQUIRE(std::is_same_v<decltype(total), x_t const>);
+            REQUIRE_THAT(total, WithinAbs(37.0 + 0.5 * 666.0, 1e-9));
+            REQUIRE_THAT(pi::td::simd::minimum(right), WithinAbs(-4.0, pi::epsilon<double>));
+            REQUIRE_THAT(pi::td::simd::maximum(right), WithinAbs(5.0, pi::epsilon<double>));
+            REQUIRE_THAT(pi::td::simd::sum(std::vector<x_t>{}), WithinAbs(0.0, pi::epsilon<double>));
+            REQUIRE_THROWS_AS(pi::td::simd::minimum(std::vector<x_t>{}), std::invalid_argument);
+        }
+
+        THEN("The columns must have the same size")
+        {
+            REQUIRE_THROWS_AS(pi::td::simd::add(left, std::span{ right }.first(3U), output), std::invalid_argument);
+        }
+    }
+
+    GIVEN("Columns of floats and ints, and a column of a struct_vector")
+    {
+        auto const masses = make_column<mass_t>(1.0, 1.0);
+        auto const hps = make_column<hp_t>(-10.0, 1.0);
+
+        THEN("The kernels work in place and for any arithmetic type")
+        {
+            auto doubled = masses;
+            pi::td::simd::add(doubled, masses, doubled);
+            REQUIRE_THAT(doubled[36], WithinAbs(74.0, pi::epsilon<float>));
+            REQUIRE_THAT(pi::td::simd::sum(masses), WithinAbs(703.0, pi::epsilon<float>));
+
+            auto clamped = std::vector<hp_t>(size);
+            pi::td::simd::clamp(hps, hp_t{ 0 }, hp_t{ 20 }, clamped);
+            REQUIRE(clamped[0] == 0);
+            REQUIRE(clamped[15] == 5);
+            REQUIRE(clamped[36] == 20);
+            REQUIRE(pi::td::simd::maximum(hps) == 26);
+        }
+
+        THEN("A struct_vector column can be used as input and output")
+        {
+            auto points = pi::tl::struct_vector<x_t, y_t>{};
+            for (auto index = 0; index < 20; ++index)
+                points.push_back(x_t{ static_cast<double>(index) });
+
+            pi::td::simd::add(points.column<x_t>(), points.column<x_t>(), points.column<x_t>());
+            REQUIRE_THAT(pi::td::simd::sum(points.column<x_t>()), WithinAbs(380.0, pi::epsilon<double>));
+        }
+    }
+}
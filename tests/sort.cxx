@@ -0,0 +1,116 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <typelists.hxx>
+using namespace pi::tl;
+
+namespace
+{
+    template <size_t Index>
+    struct element_t {};
+
+    template <size_t Size>
+    struct large_lists
+    {
+        template <size_t ...Indices>
+        static auto forward(std::index_sequence<Indices...>) -> typelist<element_t<Indices>...>;
+
+        template <size_t ...Indices>
+        static auto backward(std::index_sequence<Indices...>) -> typelist<element_t<Size - 1U - Indices>...>;
+
+        template <size_t ...Indices>
+        static auto repeated(std::index_sequence<Indices...>) -> typelist<element_t<Indices / 2U>...>;
+
+        template <size_t Period, size_t ...Indices>
+        static auto multiples(std::index_sequence<Indices...>) -> typelist<element_t<Indices * Period>...>;
+
+        using forward_t = decltype(forward(std::make_index_sequence<Size>{}));
+        using backward_t = decltype(backward(std::make_index_sequence<Size>{}));
+        using repeated_t = decltype(repeated(std::make_index_sequence<Size>{}));
+        using evens_t = decltype(multiples<2U>(std::make_index_sequence<Size / 2U>{}));
+        using thirds_t = decltype(multiples<3U>(std::make_index_sequence<Size / 3U + 1U>{}));
+    };
+}
+
+SCENARIO("sort, unique and canonical form of type lists") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("empty type lists")
+    {
+        THEN("the results are empty")
+        {
+            STATIC_REQUIRE(std::is_same_v<sort_t<typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<unique_t<typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<set_union_t<typelist<>, typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<set_intersection_t<typelist<int>, typelist<>>, typelist<>>);
+        }
+    }
+
+    GIVEN("permutations of the same types, with duplicates")
+    {
+        using first_t = typelist<int, double, char, int, float>;
+        using second_t = typelist<float, char, double, int>;
+
+        THEN("they sort the same way, and have the same canonical form")
+        {
+            STATIC_REQUIRE(sort_t<first_t>::size == 5U);
+            STATIC_REQUIRE(std::is_same_v<canonical_t<first_t>, sort_t<second_t>>);
+            STATIC_REQUIRE(std::is_same_v<canonical_t<first_t>, canonical_t<second_t>>);
+            STATIC_REQUIRE(std::is_same_v<apply_t<std::tuple, canonical_t<first_t>>, apply_t<std::tuple, canonical_t<second_t>>>);
+        }
+
+        THEN("unique keeps the first instance of each type, in order")
+        {
+            STATIC_REQUIRE(std::is_same_v<unique_t<first_t>, typelist<int, double, char, float>>);
+            STATIC_REQUIRE(std::is_same_v<unique_t<second_t>, second_t>);
+        }
+
+        THEN("the modifiers make distinct types")
+        {
+            STATIC_REQUIRE(unique_t<typelist<int, int const, int &, int>>::size == 3U);
+        }
+
+        THEN("union and intersection are sets, in canonical form")
+        {
+            STATIC_REQUIRE(std::is_same_v<set_union_t<first_t, typelist<bool>>, canonical_t<typelist<bool, char, double, float, int>>>);
+            STATIC_REQUIRE(std::is_same_v<set_intersection_t<first_t, typelist<bool, int, char>>, canonical_t<typelist<char, int>>>);
+        }
+    }
+}
+
+SCENARIO("sort of type lists of 4096 types (no need to raise the template instantiation depth)") // NOLINT(misc-use-anonymous-namespace)
+{
+    using lists_t = large_lists<4'096>;
+
+    THEN("a list and its reverse sort the same way")
+    {
+        STATIC_REQUIRE(std::is_same_v<sort_t<lists_t::forward_t>, sort_t<lists_t::backward_t>>);
+    }
+}
+
+SCENARIO("unique, canonical form, union and intersection of type lists of 4096 types") // NOLINT(misc-use-anonymous-namespace)
+{
+    using lists_t = large_lists<4'096>;
+    using halves_t = large_lists<2'048>;
+
+    THEN("unique removes the duplicates, and keeps the order of the first instances")
+    {
+        STATIC_REQUIRE(std::is_same_v<unique_t<lists_t::repeated_t>, halves_t::forward_t>);
+    }
+
+    THEN("the canonical form is made of the unique types, sorted")
+    {
+        STATIC_REQUIRE(std::is_same_v<canonical_t<lists_t::repeated_t>, sort_t<halves_t::backward_t>>);
+    }
+
+    THEN("union and intersection are computed by merging the sorted sets, whatever the order of the operands")
+    {
+        using evens_or_thirds_t = set_union_t<lists_t::evens_t, lists_t::thirds_t>;
+        using sixths_t = set_intersection_t<lists_t::evens_t, lists_t::thirds_t>;
+        STATIC_REQUIRE(evens_or_thirds_t::size == 2731U);
+        STATIC_REQUIRE(sixths_t::size == 683U);
+        STATIC_REQUIRE(std::is_same_v<evens_or_thirds_t, set_union_t<lists_t::thirds_t, lists_t::evens_t>>);
+        STATIC_REQUIRE(std::is_same_v<sixths_t, set_intersection_t<lists_t::thirds_t, lists_t::evens_t>>);
+    }
+}
@@ -3,6 +3,11 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 using namespace Catch::Matchers;
 
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+
 #include <struct.hxx>
 using namespace pi::tl;
 
@@ -117,4 +122,206 @@ SCENARIO("Struct with constants")
             REQUIRE_THAT(c.get<alpha_t>(), WithinAbs(1.0, pi::epsilon<double>));
         }
     }
+
+    GIVEN("A struct with constants used as a tuple")
+    {
+        using position_t = struct_with_consts_t<x_t, y_t, z_t const>;
+        position_t p{ 1.0_x, 2.0_y, z_t{ 3.0 } };
+
+        THEN("Its fields are reached by their position in the declaration, and bound by structured bindings")
+        {
+            STATIC_REQUIRE(std::tuple_size_v<position_t> == 3U);
+            STATIC_REQUIRE(std::is_same_v<std::tuple_element_t<2U, position_t>, z_t const>);
+            STATIC_REQUIRE(std::is_same_v<decltype(get<2U>(p)), z_t const &>);
+
+            get<0U>(p) = 4.0_x;
+            REQUIRE_THAT(p.get<x_t>(), WithinAbs(4.0, pi::epsilon<double>));
+
+            auto const &[x, y, z] = p;
+            REQUIRE_THAT(x, WithinAbs(4.0, pi::epsilon<double>));
+            REQUIRE_THAT(y, WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE_THAT(z, WithinAbs(3.0, pi::epsilon<double>));
+
+            auto nested = struct_with_consts_t<position_t const>{ p };
+            REQUIRE_THAT(get<1U>(get<0U>(nested)), WithinAbs(2.0, pi::epsilon<double>));
+        }
+
+        THEN("It is still the std::tuple it derives from: std::get, std::apply and the conversion to the tuple work")
+        {
+            std::get<0U>(p) = 5.0_x;
+            REQUIRE_THAT(std::get<0U>(p), WithinAbs(5.0, pi::epsilon<double>));
+            REQUIRE_THAT(std::apply([](x_t const &x, y_t const &y, z_t const &z) { return x + y + z; }, p), WithinAbs(10.0, pi::epsilon<double>));
+
+            std::tuple<x_t, y_t, z_t const> const &tuple = p;
+            REQUIRE_THAT(std::get<z_t const>(tuple), WithinAbs(3.0, pi::epsilon<double>));
+            STATIC_REQUIRE(sizeof(position_t) == sizeof(std::tuple<x_t, y_t, z_t const>));
+        }
+    }
+}
+
+namespace
+{
+    struct no_default_t
+    {
+        explicit no_default_t(int const value) : value{ value } {}
+
+        int value;
+    };
+
+    using serial_t = pi::td::typedecl<no_default_t, TAG(NoDefault)>;
+    using owner_t = pi::td::typedecl<std::unique_ptr<int>, TAG(Owner)>;
+}
+
+SCENARIO("Struct constructed in place")
+{
+    GIVEN("A struct with a move-only field and a field that is not default constructible")
+    {
+        using record_t = struct_t<x_t, owner_t, serial_t>;
+
+        THEN("The fields are constructed from the arguments, in any order, and the missing ones are value-initialized")
+        {
+            record_t r{ serial_t{ 7 }, owner_t{ new int{ 42 } } };
+            REQUIRE(r.get<serial_t>().value == 7);
+            REQUIRE(*r.get<owner_t>() == 42);
+            REQUIRE_THAT(r.get<x_t>(), WithinAbs(0.0, pi::epsilon<double>));
+        }
+
+        THEN("An argument that is an lvalue is copied, an argument that is an rvalue is moved")
+        {
+            auto const id = serial_t{ 3 };
+            auto owner = owner_t{ new int{ 5 } };
+            auto const *const pointer = owner.get();
+            record_t r{ std::move(owner), 1.5_x, id };
+            REQUIRE(r.get<owner_t>().get() == pointer);
+            REQUIRE(r.get<serial_t>().value == 3);
+            REQUIRE_THAT(r.get<x_t>(), WithinAbs(1.5, pi::epsilon<double>));
+        }
+
+        THEN("A later argument of the same type overrides an earlier one")
+        {
+            record_t r{ 1.0_x, serial_t{ 1 }, 2.0_x, serial_t{ 2 } };
+            REQUIRE_THAT(r.get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE(r.get<serial_t>().value == 2);
+        }
+    }
+
+    GIVEN("A struct with several fields of the same type")
+    {
+        using segment_t = struct_t<x_t, y_t, x_t>;
+
+        THEN("The nth field of a type is constructed from the nth argument of that type")
+        {
+            segment_t s{ 2.0_x, 1.0_y, 3.0_x };
+            REQUIRE_THAT(s.get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE_THAT(s.get<y_t>(), WithinAbs(1.0, pi::epsilon<double>));
+
+            auto copy = s;
+            REQUIRE_THAT(copy.get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+        }
+
+        THEN("The extra arguments of a type override the first ones")
+        {
+            segment_t s{ 1.0_x, 2.0_x, 4.0_y, 3.0_x };
+            REQUIRE_THAT(s.get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE_THAT(s.get<y_t>(), WithinAbs(4.0, pi::epsilon<double>));
+        }
+    }
+}
+
+namespace
+{
+    using flag_t = pi::td::typedecl<char, TAG(Flag)>;
+    using count_t = pi::td::typedecl<int, TAG(Count)>;
+    using mass_t = pi::td::typedecl<double, TAG(Mass)>;
+}
+
+SCENARIO("Struct with packed layout")
+{
+    GIVEN("Fields declared in an order that needs padding")
+    {
+        using report_t = layout_report<flag_t, mass_t, count_t, flag_t>;
+
+        THEN("The packed struct is smaller")
+        {
+            STATIC_REQUIRE(report_t::declared_size == 24U);
+            STATIC_REQUIRE(report_t::packed_size == 16U);
+            STATIC_REQUIRE(report_t::saved_bytes == 8U);
+            STATIC_REQUIRE(layout_report<x_t, y_t, z_t>::saved_bytes == 0U);
+        }
+
+        THEN("The fields are still looked up by type")
+        {
+            packed_struct_t<flag_t, mass_t, count_t, flag_t> s{ count_t{ 3 }, flag_t{ 'a' }, mass_t{ 2.5 }, flag_t{ 'b' } };
+            REQUIRE(s.get<flag_t>() == 'a');
+            REQUIRE(s.get<count_t>() == 3);
+            REQUIRE_THAT(s.get<mass_t>(), WithinAbs(2.5, pi::epsilon<double>));
+
+            s.set(count_t{ 4 });
+            REQUIRE(s.get<count_t>() == 4);
+        }
+
+        THEN("The constructor of a packed struct with constants takes the fields in the declared order")
+        {
+            packed_struct_with_consts_t<flag_t, mass_t const, count_t> s{ flag_t{ 'a' }, mass_t{ 2.5 }, count_t{ 3 } };
+            STATIC_REQUIRE(sizeof(s) == 16U);
+            REQUIRE(s.get<flag_t>() == 'a');
+            REQUIRE(s.get<count_t>() == 3);
+            REQUIRE_THAT(s.get<mass_t>(), WithinAbs(2.5, pi::epsilon<double>));
+
+            auto const &[flag, mass, count] = s;
+            REQUIRE(flag == 'a');
+            REQUIRE_THAT(mass, WithinAbs(2.5, pi::epsilon<double>));
+            REQUIRE(count == 3);
+        }
+    }
+}
+
+namespace
+{
+    struct empty_t {};
+    using marker_t = pi::td::typedecl<empty_t, TAG(Marker)>;
+
+    template <typename Type>
+    auto address_of(Type &field)
+    {
+        return reinterpret_cast<std::uintptr_t>(std::addressof(field)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+}
+
+SCENARIO("Struct storage")
+{
+    THEN("The fields of a struct with the declared layout are stored where a std::tuple of them stores them")
+    {
+        struct_t<flag_t, mass_t, count_t, flag_t> s{ count_t{ 3 }, flag_t{ 'a' }, mass_t{ 2.5 }, flag_t{ 'b' } };
+        std::tuple<flag_t, mass_t, count_t, flag_t> t{ flag_t{ 'a' }, mass_t{ 2.5 }, count_t{ 3 }, flag_t{ 'b' } };
+        STATIC_REQUIRE(sizeof(s) == sizeof(t));
+        REQUIRE(address_of(s.get<flag_t>()) - address_of(s) == address_of(std::get<0U>(t)) - address_of(t));
+        REQUIRE(address_of(s.get<mass_t>()) - address_of(s) == address_of(std::get<1U>(t)) - address_of(t));
+        REQUIRE(address_of(s.get<count_t>()) - address_of(s) == address_of(std::get<2U>(t)) - address_of(t));
+    }
+
+    THEN("An empty field takes no room")
+    {
+        STATIC_REQUIRE(std::is_empty_v<marker_t>);
+        STATIC_REQUIRE(sizeof(struct_t<mass_t, marker_t>) == sizeof(double));
+        STATIC_REQUIRE(sizeof(struct_with_consts_t<marker_t const, mass_t>) == sizeof(double));
+    }
+
+    THEN("A struct of trivially copyable fields is trivially copyable")
+    {
+        STATIC_REQUIRE(std::is_trivially_copyable_v<struct_t<flag_t, mass_t, count_t>>);
+        STATIC_REQUIRE(std::is_trivially_copyable_v<packed_struct_with_consts_t<flag_t, mass_t const>>);
+    }
+}
+
+SCENARIO("Struct relocation")
+{
+    THEN("A struct is trivially relocatable when all its fields are")
+    {
+        STATIC_REQUIRE(pi::td::is_trivially_relocatable_v<struct_t<x_t, y_t, z_t>>);
+        STATIC_REQUIRE(pi::td::is_trivially_relocatable_v<pos3_t>);
+        STATIC_REQUIRE(pi::td::is_trivially_relocatable_v<packed_struct_with_consts_t<x_t, z_t const>>);
+        STATIC_REQUIRE_FALSE(pi::td::is_trivially_relocatable_v<struct_t<x_t, owner_t>>);
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<struct_t<x_t, owner_t>>);
+    }
 }
@@ -0,0 +1,128 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+using namespace Catch::Matchers;
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include <struct_vector.hxx>
+using namespace pi::tl;
+
+#include <toolbox.hxx>
+
+namespace
+{
+    using x_t = pi::td::typedecl<double, TAG(VectorX)>;
+    using y_t = pi::td::typedecl<double, TAG(VectorY)>;
+    using hp_t = pi::td::typedecl<int, TAG(VectorHP)>;
+    using name_t = pi::td::typedecl<std::string, TAG(VectorName)>;
+
+    using npcs_t = struct_vector<name_t, x_t, y_t, hp_t>;
+
+    // Its copies and moves throw when its value is negative.
+    struct throwing_t
+    {
+        int value{};
+
+        throwing_t() = default;
+        explicit throwing_t(int const value_) : value{ value_ } {}
+        throwing_t(throwing_t const &other) : value{ other.value } { throw_if_negative(); }
+        throwing_t(throwing_t &&other) : value{ other.value } { throw_if_negative(); } // NOLINT(performance-noexcept-move-constructor)
+        throwing_t &operator =(throwing_t const &) = default;
+        throwing_t &operator =(throwing_t &&) = default;
+        ~throwing_t() = default;
+
+        void throw_if_negative() const
+        {
+            if (value < 0)
+                throw std::runtime_error("negative");
+        }
+    };
+}
+
+SCENARIO("Struct vector")
+{
+    GIVEN("An empty struct vector")
+    {
+        npcs_t npcs;
+
+        THEN("It has no records and empty columns")
+        {
+            REQUIRE(npcs.empty());
+            REQUIRE(npcs.column<x_t>().empty());
+        }
+    }
+
+    GIVEN("A struct vector with a few records, pushed with their fields in any order")
+    {
+        npcs_t npcs;
+        npcs.reserve(3U);
+        npcs.push_back(name_t{ "Alice" }, x_t{ 1.0 }, y_t{ 2.0 }, hp_t{ 100 });
+        npcs.push_back(hp_t{ 50 }, x_t{ 3.0 }, name_t{ "Bob" });
+        npcs.push_back(y_t{ 4.0 }, x_t{ 5.0 });
+
+        THEN("Each column holds the values of its field, contiguously")
+        {
+            REQUIRE(npcs.size() == 3U);
+
+            auto const xs = npcs.column<x_t>();
+            REQUIRE(xs.size() == 3U);
+            REQUIRE_THAT(std::accumulate(xs.begin(), xs.end(), 0.0), WithinAbs(9.0, pi::epsilon<double>));
+            REQUIRE(&xs[2] == &xs[0] + 2);
+
+            auto const hps = npcs.column<hp_t>();
+            REQUIRE(hps[0] == 100);
+            REQUIRE(hps[1] == 50);
+            REQUIRE(hps[2] == 0);
+        }
+
+        THEN("A row gives access to the fields of one record")
+        {
+            auto const bob = npcs[1U];
+            REQUIRE(bob.get<name_t>() == "Bob");
+            REQUIRE_THAT(bob.get<x_t>(), WithinAbs(3.0, pi::epsilon<double>));
+            REQUIRE_THAT(bob.get<y_t>(), WithinAbs(0.0, pi::epsilon<double>));
+
+            bob.set(y_t{ 6.0 });
+            REQUIRE_THAT(npcs.column<y_t>()[1], WithinAbs(6.0, pi::epsilon<double>));
+
+            auto const &constant = npcs;
+            REQUIRE(constant[2U].get<name_t>().empty());
+        }
+
+        THEN("Writing through a column changes the records")
+        {
+            for (auto &x : npcs.column<x_t>())
+                x = x_t{ x * 2.0 };
+
+            REQUIRE_THAT(npcs[0U].get<x_t>(), WithinAbs(2.0, pi::epsilon<double>));
+            REQUIRE_THAT(npcs[2U].get<x_t>(), WithinAbs(10.0, pi::epsilon<double>));
+
+            npcs.clear();
+            REQUIRE(npcs.empty());
+        }
+    }
+    GIVEN("A struct vector whose last field throws when it is constructed")
+    {
+        auto records = struct_vector<x_t, hp_t, throwing_t>{};
+        records.push_back(x_t{ 1.0 }, throwing_t{ 1 });
+
+        THEN("A push_back that throws leaves every column as it was")
+        {
+            for (auto attempt = 0; attempt < 3; ++attempt)
+                REQUIRE_THROWS_AS(records.push_back(x_t{ 2.0 }, hp_t{ 2 }, throwing_t{ -1 }), std::runtime_error);
+
+            REQUIRE(records.size() == 1U);
+            REQUIRE(records.column<x_t>().size() == 1U);
+            REQUIRE(records.column<hp_t>().size() == 1U);
+            REQUIRE(records.column<throwing_t>().size() == 1U);
+
+            records.push_back(x_t{ 3.0 }, throwing_t{ 3 });
+            REQUIRE(records.size() == 2U);
+            REQUIRE_THAT(records[1U].get<x_t>(), WithinAbs(3.0, pi::epsilon<double>));
+            REQUIRE(records[1U].get<throwing_t>().value == 3);
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <type_traits>
+#include <utility>
+
+#include <typelists.hxx>
+using namespace pi::tl;
+
+namespace
+{
+    template <size_t Index>
+    struct element_t {};
+
+    template <typename Type>
+    struct is_even : std::false_type {};
+
+    template <size_t Index>
+    struct is_even<element_t<Index>> : std::bool_constant<Index % 2U == 0U> {};
+
+    template <size_t Size>
+    struct large_lists
+    {
+        template <size_t ...Indices>
+        static auto forward(std::index_sequence<Indices...>) -> typelist<element_t<Indices>...>;
+
+        template <size_t ...Indices>
+        static auto backward(std::index_sequence<Indices...>) -> typelist<element_t<Size - 1U - Indices>...>;
+
+        template <size_t Offset, size_t ...Indices>
+        static auto from(std::index_sequence<Indices...>) -> typelist<element_t<Offset + Indices>...>;
+
+        template <size_t Period, size_t Offset, size_t ...Indices>
+        static auto every(std::index_sequence<Indices...>) -> typelist<element_t<Offset + Indices * Period>...>;
+
+        using forward_t = decltype(forward(std::make_index_sequence<Size>{}));
+        using backward_t = decltype(backward(std::make_index_sequence<Size>{}));
+        using first_half_t = decltype(from<0U>(std::make_index_sequence<Size / 2U>{}));
+        using second_half_t = decltype(from<Size / 2U>(std::make_index_sequence<Size / 2U>{}));
+        using evens_t = decltype(every<2U, 0U>(std::make_index_sequence<Size / 2U>{}));
+        using odds_t = decltype(every<2U, 1U>(std::make_index_sequence<Size / 2U>{}));
+    };
+}
+
+SCENARIO("transformations of type lists") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("empty type lists")
+    {
+        THEN("the results are empty")
+        {
+            STATIC_REQUIRE(std::is_same_v<concat_t<>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<concat_t<typelist<>, typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_integral, typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<transform_t<std::add_pointer_t, typelist<>>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<partition_t<std::is_integral, typelist<>>, typelist<typelist<>, typelist<>>>);
+            STATIC_REQUIRE(std::is_same_v<slice_t<typelist<>, 0U, 0U>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<reverse_t<typelist<>>, typelist<>>);
+        }
+    }
+
+    GIVEN("a type list with several 'variations' of int: const, references")
+    {
+        using list_t = typelist<char, int, int const, double, int &, int, int const &>;
+
+        THEN("concat joins any number of lists, in order")
+        {
+            STATIC_REQUIRE(std::is_same_v<concat_t<list_t>, list_t>);
+            STATIC_REQUIRE(std::is_same_v<concat_t<typelist<char, int>, typelist<>, typelist<int const, double>, typelist<int &, int, int const &>>, list_t>);
+        }
+
+        THEN("filter keeps the types satisfying the predicate, which is given the types without modifiers unless the strategy is strict")
+        {
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_floating_point, list_t>, typelist<double>>);
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_const, list_t>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_const, list_t, matching::strict>, typelist<int const>>);
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_integral, list_t>, typelist<char, int, int const, int &, int, int const &>>);
+            STATIC_REQUIRE(std::is_same_v<filter_t<std::is_integral, list_t, matching::strict>, typelist<char, int, int const, int>>);
+        }
+
+        THEN("transform applies the transformation to each type, given as it is unless the strategy is relaxed")
+        {
+            STATIC_REQUIRE(std::is_same_v<transform_t<std::add_pointer_t, typelist<int const &, char>>, typelist<int const *, char *>>);
+            STATIC_REQUIRE(std::is_same_v<transform_t<std::add_pointer_t, typelist<int const &, char>, matching::relaxed>, typelist<int *, char *>>);
+            STATIC_REQUIRE(std::is_same_v<transform_t<std::type_identity_t, list_t>, list_t>);
+            STATIC_REQUIRE(std::is_same_v<transform_t<std::remove_cvref_t, list_t>, transform_t<std::type_identity_t, list_t, matching::relaxed>>);
+        }
+
+        THEN("partition splits the list in the types satisfying the predicate and the others, in order")
+        {
+            using partitions_t = partition_t<std::is_integral, list_t, matching::strict>;
+            STATIC_REQUIRE(std::is_same_v<partitions_t::at_t<0>, typelist<char, int, int const, int>>);
+            STATIC_REQUIRE(std::is_same_v<partitions_t::at_t<1>, typelist<double, int &, int const &>>);
+        }
+
+        THEN("slice and reverse select by position")
+        {
+            STATIC_REQUIRE(std::is_same_v<slice_t<list_t, 2U, 5U>, typelist<int const, double, int &>>);
+            STATIC_REQUIRE(std::is_same_v<slice_t<list_t, 0U, list_t::size>, list_t>);
+            STATIC_REQUIRE(std::is_same_v<slice_t<list_t, 3U, 3U>, typelist<>>);
+            STATIC_REQUIRE(std::is_same_v<reverse_t<list_t>, typelist<int const &, int, int &, double, int const, int, char>>);
+            STATIC_REQUIRE(std::is_same_v<reverse_t<reverse_t<list_t>>, list_t>);
+        }
+    }
+}
+
+SCENARIO("transformations of type lists of 1024 types (no need to raise the template instantiation depth)") // NOLINT(misc-use-anonymous-namespace)
+{
+    using lists_t = large_lists<1'024>;
+
+    THEN("slice and concat are inverse operations")
+    {
+        STATIC_REQUIRE(std::is_same_v<slice_t<lists_t::forward_t, 0U, 512U>, lists_t::first_half_t>);
+        STATIC_REQUIRE(std::is_same_v<slice_t<lists_t::forward_t, 512U, 1'024U>, lists_t::second_half_t>);
+        STATIC_REQUIRE(std::is_same_v<concat_t<lists_t::first_half_t, lists_t::second_half_t>, lists_t::forward_t>);
+    }
+
+    THEN("reverse reverses the list")
+    {
+        STATIC_REQUIRE(std::is_same_v<reverse_t<lists_t::forward_t>, lists_t::backward_t>);
+    }
+
+    THEN("filter and partition keep the order of the list")
+    {
+        STATIC_REQUIRE(std::is_same_v<filter_t<is_even, lists_t::forward_t>, lists_t::evens_t>);
+        STATIC_REQUIRE(std::is_same_v<partition_t<is_even, lists_t::forward_t>, typelist<lists_t::evens_t, lists_t::odds_t>>);
+    }
+}
@@ -0,0 +1,51 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+#include <struct.hxx>
+using namespace pi::td;
+
+namespace
+{
+    using x_t = typedecl<double, tag<"type_id.x">>;
+    using y_t = typedecl<double, tag<"type_id.y">>;
+    using hp_t = typedecl<int, tag<"type_id.hp">, arithmetic>;
+    using auto_first_t = typedecl<double, AUTO_TAG>;
+    using auto_second_t = typedecl<double, AUTO_TAG>;
+
+    std::string_view name_of(uint64_t const id)
+    {
+        switch (id)
+        {
+            case type_id_v<x_t>: return "x";
+            case type_id_v<y_t>: return "y";
+            case type_id_v<hp_t>: return "hp";
+            default: return "unknown";
+        }
+    }
+}
+
+// the ID of a named tag is the FNV-1a hash of its name, whatever the compiler
+static_assert(type_id_v<tag<"a">> == 0xaf63dc4c8601ec8cULL);
+static_assert(std::is_same_v<x_t, typedecl<double, tag<"type_id.x">>> && type_id_v<x_t> == type_id_v<typedecl<double, tag<"type_id.x">>>);
+static_assert(type_id_v<x_t> != type_id_v<y_t> && type_id_v<x_t> != type_id_v<typedecl<float, tag<"type_id.x">>>);
+static_assert(type_id_v<hp_t> == type_id_v<typedecl<int, tag<"type_id.hp">>>, "The policies do not change the ID.");
+static_assert(!std::is_same_v<auto_first_t, auto_second_t> && type_id_v<auto_first_t> != type_id_v<auto_second_t>);
+
+static_assert(type_id_v<pi::tl::struct_t<x_t, y_t>> != type_id_v<pi::tl::struct_t<y_t, x_t>>);
+static_assert(type_id_v<pi::tl::struct_t<x_t, y_t>> != type_id_v<pi::tl::packed_struct_t<x_t, y_t>>);
+static_assert(type_id_v<pi::tl::struct_with_consts_t<x_t, y_t>> != type_id_v<pi::tl::struct_with_consts_t<x_t, y_t const>>);
+
+SCENARIO("Type IDs")
+{
+    GIVEN("Typedecls with named tags")
+    {
+        THEN("Their IDs are switch labels")
+        {
+            REQUIRE(name_of(type_id_v<x_t>) == "x");
+            REQUIRE(name_of(type_id_v<hp_t>) == "hp");
+            REQUIRE(name_of(type_id_v<auto_first_t>) == "unknown");
+        }
+    }
+}
@@ -3,6 +3,10 @@
 #include <catch2/matchers/catch_matchers_floating_point.hpp>
 using namespace Catch::Matchers;
 
+#include <cstddef>
+#include <memory>
+#include <string>
+
 #include <typedecl.hxx>
 using namespace pi::td;
 
@@ -197,3 +201,100 @@ SCENARIO("given a strong type over standard library string")
         REQUIRE(s == "9876543210"s);
     }
 }
+
+namespace
+{
+    struct throwing_copy_t
+    {
+        throwing_copy_t() = default;
+        throwing_copy_t(throwing_copy_t &&) noexcept = default;
+        throwing_copy_t(throwing_copy_t const &) noexcept(false) {}
+        throwing_copy_t &operator =(throwing_copy_t &&) noexcept = default;
+        throwing_copy_t &operator =(throwing_copy_t const &) noexcept(false) { return *this; }
+    };
+
+    struct final_throwing_copy_t final : throwing_copy_t {};
+
+    struct point_t
+    {
+        double x;
+        double y;
+    };
+}
+
+SCENARIO("given strong types, their exception specifications and triviality are those of the underlying types")
+{
+    using name_t = typedecl<std::string, AUTO_TAG>;
+    using throwing_t = typedecl<throwing_copy_t, AUTO_TAG>;
+    using final_throwing_t = typedecl<final_throwing_copy_t, AUTO_TAG>;
+    using point2_t = typedecl<point_t, AUTO_TAG>;
+    using length_t = typedecl<double, AUTO_TAG>;
+    using namespace std::string_literals;
+
+    THEN("copies may throw only when those of the underlying type may")
+    {
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<name_t>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_copy_constructible_v<name_t>);
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<throwing_t>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_copy_constructible_v<throwing_t>);
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<final_throwing_t>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_copy_constructible_v<final_throwing_t>);
+        STATIC_REQUIRE_FALSE(std::is_nothrow_copy_assignable_v<final_throwing_t>);
+    }
+
+    THEN("they are trivially copyable and relocatable when the underlying type is")
+    {
+        STATIC_REQUIRE(std::is_trivially_copyable_v<length_t>);
+        STATIC_REQUIRE(std::is_trivially_copyable_v<point2_t>);
+        STATIC_REQUIRE(std::is_trivially_destructible_v<length_t>);
+        STATIC_REQUIRE(is_trivially_relocatable_v<length_t>);
+        STATIC_REQUIRE(is_trivially_relocatable_v<point2_t>);
+        STATIC_REQUIRE_FALSE(is_trivially_relocatable_v<name_t>);
+    }
+
+    THEN("they are relocated with their bytes when trivially relocatable, with their move constructor otherwise")
+    {
+        point2_t points[3]{};
+        points[0].x = 1.0;
+        points[0].y = 2.0;
+        points[1].x = 3.0;
+        points[1].y = 4.0;
+        auto *const end = relocate(points, points + 2, points + 1);
+        REQUIRE(end == points + 3);
+        REQUIRE(points[2].x == 3.0);
+        REQUIRE(points[1].y == 2.0);
+
+        alignas(name_t) std::byte storage[2 * sizeof(name_t)];
+        name_t names[2]{ name_t{ "first" }, name_t{ "second" } };
+        auto *const relocated = reinterpret_cast<name_t *>(storage);
+        relocate(names, names + 2, relocated);
+        REQUIRE(relocated[1] == "second"s);
+        std::destroy(relocated, relocated + 2);
+        std::construct_at(names + 0, "restored"); // names are destroyed at the end of the scope
+        std::construct_at(names + 1, "restored");
+    }
+
+    THEN("they are relocated within overlapping ranges, in either direction, with or without their bytes")
+    {
+        alignas(name_t) std::byte storage[3 * sizeof(name_t)];
+        auto *const slots = reinterpret_cast<name_t *>(storage);
+        std::construct_at(slots + 0, "first");
+        std::construct_at(slots + 1, "second");
+
+        REQUIRE(relocate(slots, slots + 2, slots + 1) == slots + 3);
+        REQUIRE(slots[1] == "first"s);
+        REQUIRE(slots[2] == "second"s);
+
+        REQUIRE(relocate(slots + 1, slots + 3, slots) == slots + 2);
+        REQUIRE(slots[0] == "first"s);
+        REQUIRE(slots[1] == "second"s);
+        std::destroy(slots, slots + 2);
+
+        point2_t points[3]{};
+        points[1].x = 3.0;
+        points[2].x = 5.0;
+        relocate(points + 1, points + 3, points);
+        REQUIRE(points[0].x == 3.0);
+        REQUIRE(points[1].x == 5.0);
+    }
+}
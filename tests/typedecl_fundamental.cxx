@@ -217,3 +217,103 @@ SCENARIO("given a strong type over a floating point number")
         REQUIRE_THAT(r / r, WithinAbs(1.0, pi::epsilon<double>));
     }
 }
+
+namespace
+{
+    using meters_t = typedecl<double, TAG(Meters), arithmetic, comparison>;
+    using seconds_t = typedecl<double, TAG(Seconds), arithmetic, comparison>;
+    using count_t = typedecl<int, TAG(Count), arithmetic, comparison>;
+    using plain_t = typedecl<double, TAG(Plain)>;
+
+    template <typename Left, typename Right>
+    concept addable = requires(Left left, Right right) { left + right; };
+
+    template <typename Left, typename Right>
+    concept comparable = requires(Left left, Right right) { left < right; };
+
+    auto constexpr accumulate(meters_t distance, meters_t const step, int const times) noexcept
+    {
+        for (auto index = 0; index < times; ++index)
+            distance += step;
+
+        return distance;
+    }
+}
+
+SCENARIO("given a strong type over a number, with the arithmetic and comparison policies")
+{
+    THEN("it has the size, the alignment and the trivial copyability of the number")
+    {
+        STATIC_REQUIRE(sizeof(meters_t) == sizeof(double));
+        STATIC_REQUIRE(alignof(meters_t) == alignof(double));
+        STATIC_REQUIRE(std::is_trivially_copyable_v<meters_t>);
+        STATIC_REQUIRE(sizeof(count_t) == sizeof(int));
+        STATIC_REQUIRE(std::is_trivially_copyable_v<plain_t>);
+    }
+
+    THEN("the arithmetic keeps the tag and is constexpr")
+    {
+        meters_t constexpr a{ 1.5 };
+        meters_t constexpr b{ 2.0 };
+
+        STATIC_REQUIRE(std::is_same_v<decltype(a + b), meters_t>);
+        STATIC_REQUIRE(std::is_same_v<decltype(a * 2.0), meters_t>);
+        STATIC_REQUIRE(std::is_same_v<decltype(-a), meters_t>);
+        STATIC_REQUIRE(noexcept(a + b));
+        STATIC_REQUIRE(accumulate(meters_t{}, meters_t{ 0.5 }, 4) == meters_t{ 2.0 });
+        STATIC_REQUIRE(a < b);
+        STATIC_REQUIRE((a <=> b) == std::partial_ordering::less);
+
+        REQUIRE_THAT(a + b, WithinAbs(3.5, pi::epsilon<double>));
+        REQUIRE_THAT(a - b, WithinAbs(-0.5, pi::epsilon<double>));
+        REQUIRE_THAT(a * b, WithinAbs(3.0, pi::epsilon<double>));
+        REQUIRE_THAT(b / a, WithinAbs(4.0 / 3.0, pi::epsilon<double>));
+        REQUIRE_THAT(2.0 * a, WithinAbs(3.0, pi::epsilon<double>));
+        REQUIRE_THAT(b / 4.0, WithinAbs(0.5, pi::epsilon<double>));
+    }
+
+    THEN("the compound assignments and, for integers, the modulo and the increments are available")
+    {
+        count_t c{ 7 };
+        c %= count_t{ 4 };
+        REQUIRE(c == count_t{ 3 });
+        REQUIRE(c++ == count_t{ 3 });
+        REQUIRE(--c == count_t{ 3 });
+        c *= 3;
+        c -= count_t{ 1 };
+        c /= count_t{ 2 };
+        REQUIRE(c == count_t{ 4 });
+    }
+
+    THEN("strong types with different tags, or a strong type and a raw number, cannot be added together")
+    {
+        STATIC_REQUIRE(addable<meters_t, meters_t>);
+        STATIC_REQUIRE_FALSE(addable<meters_t, seconds_t>);
+        STATIC_REQUIRE_FALSE(addable<meters_t, plain_t>);
+        STATIC_REQUIRE_FALSE(addable<plain_t, meters_t>);
+        STATIC_REQUIRE_FALSE(addable<meters_t, double>);
+        STATIC_REQUIRE_FALSE(comparable<meters_t, seconds_t>);
+        STATIC_REQUIRE(comparable<meters_t, double>);
+    }
+
+    THEN("a strong type without policies keeps its behaviour")
+    {
+        plain_t p{ 1.0 };
+        STATIC_REQUIRE(std::is_same_v<decltype(p + p), double>);
+        p = plain_t{ 2.0 };
+        REQUIRE_THAT(p, WithinAbs(2.0, pi::epsilon<double>));
+    }
+}
+
+SCENARIO("given a strong type over a number, with the comparison policy, min, max and clamp keep the tag")
+{
+    meters_t constexpr a{ 1.0 };
+    meters_t constexpr b{ 3.0 };
+
+    STATIC_REQUIRE(min(a, b) == a);
+    STATIC_REQUIRE(max(a, b) == b);
+    STATIC_REQUIRE(clamp(meters_t{ 5.0 }, a, b) == b);
+    STATIC_REQUIRE(clamp(meters_t{ -5.0 }, a, b) == a);
+    STATIC_REQUIRE(clamp(meters_t{ 2.0 }, a, b) == meters_t{ 2.0 });
+    STATIC_REQUIRE(std::is_same_v<decltype(clamp(a, a, b)), meters_t>);
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <typelists.hxx>
+using namespace pi::tl;
+
+SCENARIO("typelist") // NOLINT(misc-use-anonymous-namespace)
+{
+    GIVEN("an empty typelist")
+    {
+        auto constexpr list = typelist<>{};
+
+        THEN("it has no types, count always returns 0 and find always returns npos")
+        {
+            STATIC_REQUIRE(decltype(list)::size == 0U);
+            STATIC_REQUIRE(count<int>(list) == 0U);
+            STATIC_REQUIRE(find<int>(list) == npos);
+            STATIC_REQUIRE(find_nth<matching::strict, int, 2>(list) == npos);
+        }
+    }
+
+    GIVEN("a typelist with several 'variations' of int: const, references")
+    {
+        using list_t = typelist<char, int, int const, double, int &, int, int const &>;
+        auto constexpr list = list_t{};
+
+        THEN("the types can be selected by index")
+        {
+            STATIC_REQUIRE(list_t::size == 7U);
+            STATIC_REQUIRE(std::is_same_v<list_t::at_t<0>, char>);
+            STATIC_REQUIRE(std::is_same_v<list_t::at_t<4>, int &>);
+            STATIC_REQUIRE(std::is_same_v<list_t::at_t<6>, int const &>);
+        }
+
+        THEN("count returns the same results as when counting in the type list directly")
+        {
+            STATIC_REQUIRE(count<matching::strict, int>(list) == 2U);
+            STATIC_REQUIRE(count<matching::strict, int>(list) == count<matching::strict, int, char, int, int const, double, int &, int, int const &>());
+            STATIC_REQUIRE(count<int>(list) == 5U);
+            STATIC_REQUIRE(count<int const &>(list) == count<int const &, char, int, int const, double, int &, int, int const &>());
+            STATIC_REQUIRE(count<float>(list) == 0U);
+        }
+
+        THEN("find and find_nth return the same results as when searching in the type list directly")
+        {
+            STATIC_REQUIRE(find<matching::strict, int const>(list) == 2);
+            STATIC_REQUIRE(find<int const>(list) == 1);
+            STATIC_REQUIRE(find_nth<matching::strict, int, 2>(list) == 5);
+            STATIC_REQUIRE(find_nth<int, 4>(list) == 5);
+            STATIC_REQUIRE(find_nth<int, 5>(list) == find_nth<int, 5, char, int, int const, double, int &, int, int const &>());
+            STATIC_REQUIRE(find_nth<int, 6>(list) == npos);
+            STATIC_REQUIRE(find<matching::strict, double &>(list) == npos);
+        }
+
+        THEN("the positions of a type are available as an array")
+        {
+            auto constexpr &positions = list_t::positions<matching::relaxed, int>;
+            STATIC_REQUIRE(positions.size() == 5U);
+            STATIC_REQUIRE(positions[0] == 1U);
+            STATIC_REQUIRE(positions[4] == 6U);
+        }
+    }
+}